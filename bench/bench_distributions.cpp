@@ -0,0 +1,302 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "helper_benchmark.hpp"
+
+#include <crand/distributions/ball_distribution.hpp>
+#include <crand/distributions/bernoulli_distribution.hpp>
+#include <crand/distributions/compact_uniform_real_distribution.hpp>
+#include <crand/distributions/distribution_array.hpp>
+#include <crand/distributions/generate_n.hpp>
+#include <crand/distributions/half_normal_distribution.hpp>
+#include <crand/distributions/multivariate_normal_distribution.hpp>
+#include <crand/distributions/normal_distribution.hpp>
+#include <crand/distributions/simplex_distribution.hpp>
+#include <crand/distributions/static_discrete_distribution.hpp>
+#include <crand/distributions/static_uniform_int_distribution.hpp>
+#include <crand/distributions/truncated_normal_distribution.hpp>
+#include <crand/distributions/uniform_int_distribution.hpp>
+#include <crand/distributions/uniform_real_distribution.hpp>
+#include <crand/distributions/unit_sphere_distribution.hpp>
+#include <crand/engines/bit_buffer.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+#include <crand/views/random_view.hpp>
+
+#include <array>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t iterations = std::size_t{1} << 26u;
+
+template<typename G, typename D>
+void bench_distribution(std::string_view name, D const& d)
+{
+    G g;
+    helper_benchmark(name, iterations, [&] { return d(g); });
+}
+
+/// Like `bench_distribution`, but values are produced 1024 at a time through `crand::generate_n`.
+template<typename G, typename D>
+void bench_generate_n(std::string_view name, D d)
+{
+    G                                         g;
+    std::array<typename D::result_type, 1024> buffer{};
+    std::size_t                               i = buffer.size();
+    helper_benchmark(name,
+                     iterations,
+                     [&]
+                     {
+                         if (i == buffer.size())
+                         {
+                             crand::generate_n(d, g, buffer.begin(), buffer.size());
+                             i = 0;
+                         }
+                         return buffer[i++];
+                     });
+}
+
+/// Like `bench_generate_n`, but the buffer is filled through `generate_packed`.
+template<typename G, typename D>
+void bench_generate_packed(std::string_view name, D d)
+{
+    G                                         g;
+    std::array<typename D::result_type, 1024> buffer{};
+    std::size_t                               i = buffer.size();
+    helper_benchmark(name,
+                     iterations,
+                     [&]
+                     {
+                         if (i == buffer.size())
+                         {
+                             d.generate_packed(g, buffer);
+                             i = 0;
+                         }
+                         return buffer[i++];
+                     });
+}
+} // namespace
+
+void bench_distributions()
+{
+    using crand::bit_buffer;
+    using crand::inclusive;
+    using crand::pcg64;
+    using crand::splitmix64;
+    using crand::xoshiro256_starstar;
+
+    crand::uniform_int_distribution const dice{inclusive{1}, inclusive{6}};
+    bench_distribution<xoshiro256_starstar>("uniform_int [1, 6] (xoshiro256_starstar)", dice);
+    bench_distribution<bit_buffer<xoshiro256_starstar>>("uniform_int [1, 6] (bit_buffer<xoshiro256_starstar>)", dice);
+    bench_distribution<pcg64>("uniform_int [1, 6] (pcg64)", dice);
+    bench_distribution<bit_buffer<pcg64>>("uniform_int [1, 6] (bit_buffer<pcg64>)", dice);
+
+    crand::static_uniform_int_distribution<int, 1, 6> const static_dice;
+    bench_distribution<xoshiro256_starstar>("static_uniform_int [1, 6]", static_dice);
+
+    crand::uniform_int_distribution const                   octal{inclusive{0}, inclusive{7}};
+    crand::static_uniform_int_distribution<int, 0, 7> const static_octal;
+    bench_distribution<xoshiro256_starstar>("uniform_int [0, 7]", octal);
+    bench_distribution<xoshiro256_starstar>("static_uniform_int [0, 7]", static_octal);
+
+    crand::static_discrete_distribution<1, 2, 3, 4, 5, 6, 7, 8> const weighted;
+    bench_distribution<xoshiro256_starstar>("static_discrete <1, ..., 8>", weighted);
+
+    crand::bernoulli_distribution const coin{0.3};
+    bench_distribution<xoshiro256_starstar>("bernoulli 0.3 (xoshiro256_starstar)", coin);
+    bench_distribution<bit_buffer<xoshiro256_starstar>>("bernoulli 0.3 (bit_buffer<xoshiro256_starstar>)", coin);
+    bench_distribution<pcg64>("bernoulli 0.3 (pcg64)", coin);
+    bench_distribution<bit_buffer<pcg64>>("bernoulli 0.3 (bit_buffer<pcg64>)", coin);
+
+    using crand::chacha20;
+    using crand::exclusive;
+    bench_distribution<xoshiro256_starstar>("uniform_int [1, 6] (scalar)", dice);
+    bench_generate_n<xoshiro256_starstar>("uniform_int [1, 6] (generate_n)", dice);
+    bench_distribution<chacha20>("uniform_int [1, 6] (chacha20, scalar)", dice);
+    bench_generate_n<chacha20>("uniform_int [1, 6] (chacha20, generate_n)", dice);
+    bench_generate_n<xoshiro256_starstar>("static_uniform_int [1, 6] (generate_n)", static_dice);
+    bench_generate_n<xoshiro256_starstar>("static_uniform_int [0, 7] (generate_n)", static_octal);
+    {
+        xoshiro256_starstar g;
+        auto                view = crand::views::random(g, dice);
+        auto                it   = view.begin();
+        helper_benchmark("uniform_int [1, 6] (views::random)",
+                         iterations,
+                         [&]
+                         {
+                             auto const x = *it;
+                             ++it;
+                             return x;
+                         });
+    }
+
+    crand::uniform_real_distribution const unit{inclusive{0.}, exclusive{1.}};
+    bench_distribution<xoshiro256_starstar>("uniform_real [0, 1) (scalar)", unit);
+    bench_generate_n<xoshiro256_starstar>("uniform_real [0, 1) (generate_n)", unit);
+    bench_generate_n<splitmix64>("uniform_real [0, 1) (splitmix64, generate_n)", unit);
+    crand::uniform_real_distribution const unit_float{inclusive{0.f}, exclusive{1.f}};
+    bench_distribution<xoshiro256_starstar>("uniform_real<float> [0, 1) (scalar)", unit_float);
+    bench_generate_n<xoshiro256_starstar>("uniform_real<float> [0, 1) (generate_n)", unit_float);
+    bench_generate_packed<xoshiro256_starstar>("uniform_real<float> [0, 1) (generate_packed)", unit_float);
+    {
+        // A range that moves with every sample, staying within [64, 128) so that gamma doesn't change
+        using param_type = crand::uniform_real_distribution<double>::param_type;
+        xoshiro256_starstar g;
+        unsigned            step  = 0;
+        auto const          lower = [&] { return 64. + static_cast<double>(++step % 256) / 16; };
+        helper_benchmark("uniform_real moving range (construction only)",
+                         iterations,
+                         [&]
+                         {
+                             auto const a = lower();
+                             return crand::uniform_real_distribution{inclusive{a}, exclusive{a + 1}}.max();
+                         });
+        helper_benchmark("uniform_real moving range (constructed per sample)",
+                         iterations,
+                         [&]
+                         {
+                             auto const a = lower();
+                             return crand::uniform_real_distribution{inclusive{a}, exclusive{a + 1}}(g);
+                         });
+        helper_benchmark("uniform_real moving range (param_type per sample)",
+                         iterations,
+                         [&]
+                         {
+                             auto const a = lower();
+                             return unit(g, param_type{inclusive{a}, exclusive{a + 1}});
+                         });
+        param_type p{inclusive{64.}, exclusive{65.}};
+        helper_benchmark("uniform_real moving range (rebind per sample)",
+                         iterations,
+                         [&]
+                         {
+                             auto const a = lower();
+                             p            = p.rebind(inclusive{a}, exclusive{a + 1});
+                             return unit(g, p);
+                         });
+    }
+    {
+        // One sample from each of many distributions, as with one distribution per entity
+        constexpr std::size_t entities = std::size_t{1} << 20u;
+        using compact_type             = crand::compact_uniform_real_distribution<double>;
+        std::vector<crand::uniform_real_distribution<double>> regular;
+        std::vector<compact_type>                             compact;
+        for (std::size_t i = 0; i < entities; ++i)
+        {
+            auto const a = static_cast<double>(i % 1000);
+            regular.emplace_back(inclusive{a}, exclusive{a + 1 + static_cast<double>(i % 7)});
+            compact.emplace_back(inclusive{a}, exclusive{a + 1 + static_cast<double>(i % 7)});
+        }
+        crand::distribution_array<compact_type> const array(compact);
+
+        xoshiro256_starstar g;
+        std::size_t         i = 0;
+        helper_benchmark("uniform_real 2^20 entities (regular)",
+                         iterations,
+                         [&] { return regular[i++ % entities](g); });
+        helper_benchmark("uniform_real 2^20 entities (compact)",
+                         iterations,
+                         [&] { return compact[i++ % entities](g); });
+        std::vector<double> buffer(entities);
+        i = entities;
+        helper_benchmark("uniform_real 2^20 entities (distribution_array)",
+                         iterations,
+                         [&]
+                         {
+                             if (i == entities)
+                             {
+                                 array.generate(g, buffer);
+                                 i = 0;
+                             }
+                             return buffer[i++];
+                         });
+    }
+    bench_distribution<xoshiro256_starstar>("bernoulli 0.3 (scalar)", coin);
+    bench_generate_n<xoshiro256_starstar>("bernoulli 0.3 (generate_n)", coin);
+
+    crand::normal_distribution<double> normal;
+    helper_benchmark("normal (scalar)",
+                     iterations,
+                     [&, g = xoshiro256_starstar{}]() mutable { return normal(g); });
+    bench_generate_n<xoshiro256_starstar>("normal (generate_n)", normal);
+
+    auto const bench_stateful = [](std::string_view name, auto d)
+    { helper_benchmark(name, iterations, [&, g = xoshiro256_starstar{}]() mutable { return d(g); }); };
+    bench_stateful("half_normal", crand::half_normal_distribution<double>{});
+    bench_stateful("truncated_normal [-1, 2]", crand::truncated_normal_distribution<double>{0., 1., -1., 2.});
+    bench_stateful("truncated_normal [-3, 3]", crand::truncated_normal_distribution<double>{0., 1., -3., 3.});
+    bench_stateful("truncated_normal [10, inf)",
+                   crand::truncated_normal_distribution<double>{0., 1., 10., std::numeric_limits<double>::infinity()});
+
+    {
+        constexpr std::size_t                              n = 8;
+        crand::multivariate_normal_distribution<double, n> d;
+        xoshiro256_starstar                                g;
+        helper_benchmark("multivariate_normal<8> (scalar, per vector)", iterations / n, [&] { return d(g); });
+
+        std::array<double, n * 1024> buffer{};
+        std::size_t                  i = 1024;
+        helper_benchmark("multivariate_normal<8> (generate, per vector)",
+                         iterations / n,
+                         [&]
+                         {
+                             if (i == 1024)
+                             {
+                                 d.generate(g, std::span{buffer});
+                                 i = 0;
+                             }
+                             return buffer[i++];
+                         });
+    }
+    bench_stateful("unit_sphere<3>", crand::unit_sphere_distribution<double, 3>{});
+    bench_stateful("ball<3>", crand::ball_distribution<double, 3>{});
+    bench_stateful("simplex<3>", crand::simplex_distribution<double, 3>{});
+    {
+        constexpr std::size_t                      n = 8;
+        crand::unit_sphere_distribution<double, n> d;
+        xoshiro256_starstar                        g;
+        helper_benchmark("unit_sphere<8> (scalar, per point)", iterations / n, [&] { return d(g); });
+
+        std::array<double, n * 1024> buffer{};
+        std::size_t                  i = 1024;
+        helper_benchmark("unit_sphere<8> (generate, per point)",
+                         iterations / n,
+                         [&]
+                         {
+                             if (i == 1024)
+                             {
+                                 d.generate(g, std::span{buffer});
+                                 i = 0;
+                             }
+                             return buffer[i++];
+                         });
+    }
+}
@@ -0,0 +1,98 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_benchmark.hpp"
+
+#include <crand/engines/buffered_engine.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/generate.hpp>
+#include <crand/engines/interleaved_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+#include <span>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t iterations = std::size_t{1} << 28u;
+
+template<typename G>
+void bench_engine(std::string_view name)
+{
+    G g;
+    helper_benchmark(name, iterations, [&] { return g(); });
+}
+
+/// Like `bench_engine`, but values are produced 1024 at a time through `crand::generate`.
+template<typename G>
+void bench_engine_generate(std::string_view name)
+{
+    G                                         g;
+    std::array<typename G::result_type, 1024> buffer{};
+    std::size_t                               i = buffer.size();
+    helper_benchmark(name,
+                     iterations,
+                     [&]
+                     {
+                         if (i == buffer.size())
+                         {
+                             crand::generate(g, std::span{buffer});
+                             i = 0;
+                         }
+                         return buffer[i++];
+                     });
+}
+} // namespace
+
+void bench_engines()
+{
+    bench_engine<crand::xorshift32>("xorshift32");
+    bench_engine<crand::xorshift64>("xorshift64");
+    bench_engine<crand::splitmix64>("splitmix64");
+    bench_engine_generate<crand::splitmix64>("splitmix64 (generate)");
+    bench_engine<crand::wyrand>("wyrand");
+    bench_engine<crand::romu_trio>("romu_trio");
+    bench_engine<crand::romu_duo>("romu_duo");
+    bench_engine<crand::xoshiro256_starstar>("xoshiro256_starstar");
+    bench_engine_generate<crand::xoshiro256_starstar>("xoshiro256_starstar (generate)");
+    bench_engine<crand::pcg32>("pcg32");
+    bench_engine<crand::pcg64>("pcg64");
+    bench_engine<crand::chacha8>("chacha8");
+    bench_engine<crand::chacha12>("chacha12");
+    bench_engine<crand::chacha20>("chacha20");
+    bench_engine<crand::buffered_engine<crand::xoshiro256_starstar>>("buffered_engine<xoshiro256_starstar>");
+    bench_engine<crand::buffered_engine<crand::pcg64>>("buffered_engine<pcg64>");
+    bench_engine<crand::buffered_engine<crand::chacha20>>("buffered_engine<chacha20>");
+    bench_engine<crand::interleaved_engine<crand::xoshiro256_starstar>>("interleaved_engine<xoshiro256_starstar>");
+    bench_engine_generate<crand::interleaved_engine<crand::xoshiro256_starstar>>(
+        "interleaved_engine<xoshiro256_starstar> (generate)");
+    bench_engine_generate<crand::interleaved_engine<crand::splitmix64>>("interleaved_engine<splitmix64> (generate)");
+    bench_engine_generate<crand::interleaved_engine<crand::xorshift64>>("interleaved_engine<xorshift64> (generate)");
+}
@@ -0,0 +1,82 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "helper_benchmark.hpp"
+
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+#include <crand/sequences/halton_sequence.hpp>
+#include <crand/sequences/r_sequence.hpp>
+#include <crand/sequences/sobol_sequence.hpp>
+
+#include <array>
+#include <span>
+#include <string_view>
+
+#include <cstddef>
+
+namespace
+{
+constexpr std::size_t iterations = std::size_t{1} << 24u;
+
+template<typename S>
+void bench_sequence(std::string_view name, S seq)
+{
+    helper_benchmark(name, iterations, [&] { return seq()[0]; });
+}
+
+template<typename S>
+void bench_sequence_generate(std::string_view name, S seq)
+{
+    using value_type = typename S::result_type::value_type;
+
+    constexpr std::size_t              dims = std::tuple_size_v<typename S::result_type>;
+    std::array<value_type, dims * 1024> buffer{};
+    std::size_t                        i = buffer.size();
+    helper_benchmark(name,
+                     iterations,
+                     [&]
+                     {
+                         if (i == buffer.size())
+                         {
+                             seq.generate(std::span{buffer});
+                             i = 0;
+                         }
+                         i += dims;
+                         return buffer[i - dims];
+                     });
+}
+} // namespace
+
+void bench_sequences()
+{
+    crand::xoshiro256_starstar g;
+
+    bench_sequence("sobol<8> (per point)", crand::sobol_sequence<double, 8>{});
+    bench_sequence_generate("sobol<8> (generate, per point)", crand::sobol_sequence<double, 8>{});
+    bench_sequence("sobol<8> scrambled (per point)", crand::sobol_sequence<double, 8>::scrambled(g));
+    bench_sequence("halton<8> (per point)", crand::halton_sequence<double, 8>{});
+    bench_sequence("halton<8> scrambled (per point)", crand::halton_sequence<double, 8>::scrambled(g));
+    bench_sequence("r<8> (per point)", crand::r_sequence<double, 8>{});
+    bench_sequence_generate("r<8> (generate, per point)", crand::r_sequence<double, 8>{});
+}
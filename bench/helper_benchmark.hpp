@@ -0,0 +1,69 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HELPER_BENCHMARK_HPP
+#define CONSTEXPR_RANDOM_HELPER_BENCHMARK_HPP
+
+#include <chrono>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdio>
+
+/// Prevents the compiler from optimizing away the computation of `value`.
+template<typename T>
+inline void do_not_optimize(T const& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static T volatile sink;
+    sink = value;
+#endif
+}
+
+/// Runs `f` `iterations` times and prints the average time per call.
+template<typename F>
+void helper_benchmark(std::string_view name, std::size_t iterations, F&& f)
+{
+    for (std::size_t i = 0; i < iterations / 16; ++i) // warm-up
+        do_not_optimize(f());
+
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+        do_not_optimize(f());
+    auto const stop = std::chrono::steady_clock::now();
+
+    std::chrono::duration<double, std::nano> const elapsed = stop - start;
+    std::printf("%-56.*s %10.3f ns/op\n",
+                static_cast<int>(name.size()),
+                name.data(),
+                elapsed.count() / static_cast<double>(iterations));
+}
+
+void bench_engines();
+void bench_distributions();
+void bench_sequences();
+
+#endif // CONSTEXPR_RANDOM_HELPER_BENCHMARK_HPP
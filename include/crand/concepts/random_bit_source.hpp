@@ -0,0 +1,56 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_RANDOM_BIT_SOURCE_HPP
+#define CONSTEXPR_RANDOM_RANDOM_BIT_SOURCE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+
+#include <concepts>
+
+#include <cstddef>
+
+namespace crand
+{
+/// A random bit source is a uniform random bit generator that can also hand out an arbitrary number of random bits.
+///
+/// # Semantic Requirements
+/// `random_bit_source` is modeled only if, given an object `g` of type `G` and a number `n` in
+/// [`1`, `G::word_bits`]:
+/// - `g.bits(n)` returns a value in [`0`, `2^n`) where each value has equal probability of being returned
+/// - `g.bits(n)` has amortized constant complexity
+///
+/// # Notes
+/// Distributions use fewer invocations of the underlying engine when given a random bit source, as they don't need to
+/// consume a full engine word per sample.
+template<class G>
+concept random_bit_source // clang-format off
+    =  uniform_random_bit_generator<G>
+    && requires (G& g, std::size_t n) {
+           { G::word_bits } -> std::convertible_to<std::size_t>;
+           { g.bits(n) } -> std::same_as<std::invoke_result_t<G&>>;
+    }; // clang-format on
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_RANDOM_BIT_SOURCE_HPP
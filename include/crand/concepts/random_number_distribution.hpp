@@ -28,6 +28,7 @@
 #include "crand/concepts/uniform_random_bit_generator.hpp"
 
 #include <concepts>
+#include <span>
 
 namespace crand
 {
@@ -53,5 +54,26 @@ concept random_number_distribution // clang-format off
         { c.min() } -> std::same_as<typename D::result_type>;
         { c.max() } -> std::same_as<typename D::result_type>;
     }; // clang-format on
+
+/// A random number distribution that can also fill a whole range of values in one call, which allows it to draw words
+/// from the engine in bulk.
+///
+/// # Semantic Requirements
+/// `batch_random_number_distribution<D>` is modeled only if `D` models `random_number_distribution` and, given any
+/// object `d` of type `D`, any object `g` modelling `uniform_random_bit_generator` and any `std::span<D::result_type>`
+/// `out`:
+/// - `d.generate(g, out)` is equivalent to assigning `d(g)` to each element of `out` in order, i.e. the values and the
+///   states of `d` and `g` afterwards are the same
+///
+/// # Notes
+/// Use `crand::generate_n` to take advantage of this without having to know whether a distribution supports it.
+template<typename D>
+concept batch_random_number_distribution // clang-format off
+    =  random_number_distribution<D>
+    && requires (D& m,
+                 detail::uniform_random_bit_generator::uniform_random_bit_generator_archetype& g,
+                 std::span<typename D::result_type> out) {
+        m.generate(g, out);
+    }; // clang-format on
 } // namespace crand
 #endif // CONSTEXPR_RANDOM_RANDOM_NUMBER_DISTRIBUTION_HPP
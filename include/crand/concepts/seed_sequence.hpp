@@ -0,0 +1,54 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SEED_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_SEED_SEQUENCE_HPP
+
+#include <concepts>
+#include <type_traits>
+
+#include <cstdint>
+
+namespace crand
+{
+/// A seed sequence is an object producing an arbitrary amount of 32 bit seed values from some initial seed material.
+///
+/// # Semantic Requirements
+/// `seed_sequence<S>` is modeled only if, given an object `s` of type `S` and iterators `first` and `last`:
+/// - `s.generate(first, last)` fills [`first`, `last`) with 32 bit values derived from the seed material
+/// - `s.generate(first, last)` is deterministic, i.e. produces the same values when invoked again
+///
+/// # Notes
+/// - Both `crand::seed_seq` and `std::seed_seq` model this concept.
+/// - `S` may be a reference type, which allows constraining forwarding references. A `const` seed sequence only models
+///   this concept if `generate` is `const`.
+template<typename S>
+concept seed_sequence // clang-format off
+    = requires (std::remove_reference_t<S>& s, std::uint32_t* p) {
+        typename std::remove_cvref_t<S>::result_type;
+        s.generate(p, p);
+    }; // clang-format on
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SEED_SEQUENCE_HPP
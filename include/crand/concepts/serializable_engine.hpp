@@ -0,0 +1,56 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SERIALIZABLE_ENGINE_HPP
+#define CONSTEXPR_RANDOM_SERIALIZABLE_ENGINE_HPP
+
+#include <array>
+#include <concepts>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace crand
+{
+/// A serializable engine exposes its complete state as a fixed-size array of unsigned integers.
+///
+/// # Semantic Requirements
+/// `serializable_engine<E>` is modeled only if, given an object `e` of type `E`:
+/// - `E::from_state(e.state()) == e`
+/// - `E::from_state(e.state())` produces the same sequence of values as `e`
+///
+/// # Notes
+/// All engines in this library model this concept.
+template<typename E>
+concept serializable_engine // clang-format off
+    = requires (E const& e, typename E::state_array const& s) {
+        requires std::unsigned_integral<typename E::state_array::value_type>;
+        requires std::is_trivially_copyable_v<typename E::state_array>;
+        { std::tuple_size<typename E::state_array>::value } -> std::convertible_to<std::size_t>;
+        { e.state() } -> std::same_as<typename E::state_array>;
+        { E::from_state(s) } -> std::same_as<E>;
+    }; // clang-format on
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SERIALIZABLE_ENGINE_HPP
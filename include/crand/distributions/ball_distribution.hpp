@@ -0,0 +1,186 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_BALL_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_BALL_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/structure_of_arrays.hpp"
+#include "crand/distributions/detail/unit_sphere_distribution_details.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+#include "crand/distributions/unit_sphere_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace crand
+{
+/// Produces points uniformly distributed in the unit ball in `D` dimensions.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates, e.g. `3` for the ordinary ball and `2` for the disk
+///
+/// # Notes
+/// - As its result type is an array, `ball_distribution` doesn't satisfy `random_number_distribution`, but otherwise
+///   provides the same interface.
+/// - For `D == 2` and `D == 3`, points are sampled uniformly from the enclosing cube and rejected if they lie outside
+///   the ball, which happens with a probability of 21% and 48% respectively. Otherwise, a point on the unit sphere is
+///   scaled by a random radius, as rejection becomes inefficient with growing `D`.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0)
+class ball_distribution
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Generates a random point in the unit ball
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random point.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `D`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) -> result_type
+    {
+        if constexpr (D == 2 || D == 3)
+        {
+            result_type point;
+            RealType    s;
+            do
+            {
+                s = 0;
+                for (auto& x : point)
+                {
+                    x = s_symmetric_unit(g);
+                    s += x * x;
+                }
+            } while (s > 1);
+            return point;
+        }
+        else
+        {
+            auto       point  = m_sphere(g);
+            auto const radius = random_radius(g);
+            for (auto& x : point)
+                x *= radius;
+            return point;
+        }
+    }
+
+    /// Generates `out.size() / D` random points in structure-of-arrays layout
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// For `D > 3`, points on the unit sphere are generated through `unit_sphere_distribution::generate` and scaled in
+    /// blocks of columns, so the points differ from those of repeated invocations of `operator()`, but follow the same
+    /// distribution.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<RealType> out)
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+
+        if constexpr (D == 2 || D == 3)
+        {
+            for (std::size_t j = 0; j < m; ++j)
+                detail::scatter((*this)(g), out, m, j);
+        }
+        else
+        {
+            constexpr auto block_columns = detail::unit_sphere_distribution::block_columns;
+
+            m_sphere.generate(g, out);
+            std::array<RealType, block_columns> radii{};
+            for (std::size_t begin = 0; begin < m; begin += block_columns)
+            {
+                auto const columns = std::min(block_columns, m - begin);
+                for (std::size_t j = 0; j < columns; ++j)
+                    radii[j] = random_radius(g);
+                for (std::size_t i = 0; i < D; ++i)
+                {
+                    auto const r = out.subspan(i * m + begin, columns);
+                    for (std::size_t j = 0; j < columns; ++j)
+                        r[j] *= radii[j];
+                }
+            }
+        }
+    }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(ball_distribution const& lhs, ball_distribution const& rhs) noexcept
+        -> bool = default;
+
+  private:
+    /// Returns the distance of a uniformly distributed point in the ball from its center.
+    template<uniform_random_bit_generator G>
+    static constexpr auto random_radius(G& g) -> RealType
+    {
+        auto const u = s_unit(g);
+        if constexpr (D == 1)
+            return u;
+        else
+            return std::pow(u, RealType{1} / D);
+    }
+
+    // Excluding both bounds avoids the `k == hi` branch the generator of a closed range takes for the upper bound; the
+    // bounds have probability zero anyway
+    static constexpr uniform_real_distribution<RealType> s_symmetric_unit{exclusive<RealType>{-1.},
+                                                                          exclusive<RealType>{1.}};
+    static constexpr uniform_real_distribution<RealType> s_unit{inclusive<RealType>{0.}, exclusive<RealType>{1.}};
+
+    unit_sphere_distribution<RealType, D> m_sphere;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_BALL_DISTRIBUTION_HPP
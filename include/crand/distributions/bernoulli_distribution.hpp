@@ -25,9 +25,16 @@
 #ifndef CONSTEXPR_RANDOM_BERNOULLI_DISTRIBUTION_HPP
 #define CONSTEXPR_RANDOM_BERNOULLI_DISTRIBUTION_HPP
 
+#include "crand/concepts/random_bit_source.hpp"
 #include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/bernoulli_distribution_details.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
 #include "crand/distributions/uniform_real_distribution.hpp"
 
+#include <algorithm>
+#include <array>
+#include <span>
+
 namespace crand
 {
 /// Produces bernoulli-distributed random boolean values.
@@ -42,6 +49,32 @@ class bernoulli_distribution
   public:
     using result_type = bool;
 
+    /// The parameters of the distribution.
+    class param_type
+    {
+      public:
+        using distribution_type = bernoulli_distribution;
+
+        /// Constructs the parameters of a distribution that returns `true` according to `p`.
+        ///
+        /// # Preconditions
+        /// Behavior is undefined if `0 <= p <= 1` doesn't hold true
+        constexpr explicit param_type(double p) noexcept
+            : m_p(p)
+        {
+            assert(p >= 0 && p <= 1);
+        }
+
+        /// Returns the `p` parameter.
+        [[nodiscard]] constexpr auto p() const noexcept -> double { return m_p; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        double m_p;
+    };
+
     /// Constructs a distribution that returns `true` 50% of the time, otherwise false.
     constexpr bernoulli_distribution() noexcept
         : bernoulli_distribution(0.5)
@@ -58,9 +91,8 @@ class bernoulli_distribution
     /// # Preconditions
     /// Behavior is undefined if `0 <= p <= 1` doesn't hold true
     constexpr explicit bernoulli_distribution(double p) noexcept
-        : m_p(p)
+        : m_param(p)
     {
-        assert(p >= 0 && p <= 1);
     }
 
     /// Generates random booleans according to `p`
@@ -73,21 +105,102 @@ class bernoulli_distribution
     ///     The generated random boolean.
     ///
     /// # Complexity
-    ///     Amortized constant number of invocations of `g()`.
+    ///     Amortized constant number of invocations of `g()`. If `g` satisfies `random_bit_source`, almost always
+    ///     only 16 bits are consumed.
     template<uniform_random_bit_generator G>
     constexpr auto operator()(G& g) const -> result_type
     {
-        return s_dist(g) < m_p;
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random booleans according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random boolean.
+    ///
+    /// # Complexity
+    ///     Same as `operator()(g)`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) const -> result_type
+    {
+        if constexpr (random_bit_source<G>)
+            return detail::bernoulli_distribution::compare_bits(g, p.p());
+        else
+            return s_dist(g) < p.p();
+    }
+
+    /// Fills `out` with random booleans according to `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        generate(g, out, m_param);
+    }
+
+    /// Fills `out` with random booleans according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g, p)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out, param_type const& p) const
+    {
+        if constexpr (random_bit_source<G>)
+        {
+            for (auto& x : out)
+                x = (*this)(g, p);
+        }
+        else
+        {
+            std::array<double, detail::generate_n::batch_size> us{};
+            for (std::size_t i = 0; i < out.size(); i += us.size())
+            {
+                auto const chunk = out.subspan(i, std::min(us.size(), out.size() - i));
+                auto const u     = std::span{us}.first(chunk.size());
+                s_dist.generate(g, u);
+                for (std::size_t j = 0; j < chunk.size(); ++j)
+                    chunk[j] = u[j] < p.p();
+            }
+        }
     }
 
     /// Returns the `p` parameter the distribution was constructed with.
-    [[nodiscard]] constexpr auto p() const noexcept -> double { return m_p; }
+    [[nodiscard]] constexpr auto p() const noexcept -> double { return m_param.p(); }
 
     /// Returns `false`
     [[nodiscard]] constexpr auto min() const noexcept -> bool { return false; }
     /// Returns `true`
     [[nodiscard]] constexpr auto max() const noexcept -> bool { return true; }
 
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
     /// Compares two distribution objects by their internal state.
     ///
     /// # Notes
@@ -98,7 +211,7 @@ class bernoulli_distribution
   private:
     constexpr static uniform_real_distribution<double> s_dist{inclusive{0.}, exclusive{1.}};
 
-    double m_p;
+    param_type m_param;
 };
 } // namespace crand
 
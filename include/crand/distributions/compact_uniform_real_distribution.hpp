@@ -0,0 +1,239 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_COMPACT_UNIFORM_REAL_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_COMPACT_UNIFORM_REAL_DISTRIBUTION_HPP
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+#include "crand/distributions/detail/uniform_real_distribution_details.hpp"
+#include "crand/distributions/distribution_limits.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <span>
+
+#include <cassert>
+#include <cstddef>
+
+namespace crand
+{
+template<random_number_distribution D>
+class distribution_array;
+
+/// Produces the same values as `uniform_real_distribution`, from a smaller object.
+///
+/// Only the bounds, gamma and the number of values are stored, with the kind of bounds packed into the spare bits of
+/// the latter; everything else is derived when sampling. A `compact_uniform_real_distribution<double>` takes 32 bytes
+/// and a `compact_uniform_real_distribution<float>` 16 bytes.
+///
+/// # Notes
+/// - `compact_uniform_real_distribution` satisfies `batch_random_number_distribution`.
+/// - Constructed with the same bounds, `compact_uniform_real_distribution` and `uniform_real_distribution` produce the
+///   same values from the same engine.
+/// - Meant for large numbers of distributions, e.g. one per entity, possibly in a `distribution_array`. For a few
+///   distributions sampled many times each, `uniform_real_distribution` is faster, as it derives nothing per sample.
+template<std::floating_point RealType = double>
+class compact_uniform_real_distribution
+{
+  public:
+    using result_type = RealType;
+
+    /// Constructs a distribution that generates numbers in [a, b]
+    ///
+    /// # Preconditions
+    /// See the corresponding constructor of `uniform_real_distribution`.
+    constexpr compact_uniform_real_distribution(inclusive<RealType> a, inclusive<RealType> b) noexcept
+        : compact_uniform_real_distribution(a.value, b.value, false, false)
+    {
+        assert(m_a <= m_b);
+    }
+
+    /// Constructs a distribution that generates numbers in (a, b]
+    ///
+    /// # Preconditions
+    /// See the corresponding constructor of `uniform_real_distribution`.
+    constexpr compact_uniform_real_distribution(exclusive<RealType> a, inclusive<RealType> b) noexcept
+        : compact_uniform_real_distribution(a.value, b.value, true, false)
+    {
+        assert(m_a < m_b);
+    }
+
+    /// Constructs a distribution that generates numbers in [a, b)
+    ///
+    /// # Preconditions
+    /// See the corresponding constructor of `uniform_real_distribution`.
+    constexpr compact_uniform_real_distribution(inclusive<RealType> a, exclusive<RealType> b) noexcept
+        : compact_uniform_real_distribution(a.value, b.value, false, true)
+    {
+        assert(m_a < m_b);
+    }
+
+    /// Constructs a distribution that generates numbers in (a, b)
+    ///
+    /// # Preconditions
+    /// See the corresponding constructor of `uniform_real_distribution`.
+    constexpr compact_uniform_real_distribution(exclusive<RealType> a, exclusive<RealType> b) noexcept
+        : compact_uniform_real_distribution(a.value, b.value, true, true)
+    {
+        assert(m_a < m_b);
+    }
+
+    /// Generates random numbers in the desired range
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random number, the same as that of the corresponding `uniform_real_distribution`.
+    ///
+    /// # Complexity
+    ///     Amortized constant number of invocations of `g()`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) const -> result_type
+    {
+        namespace d = detail::uniform_real_distribution;
+
+        auto const k = index_distribution()(g);
+        return d::gen(m_kind, m_a, m_b, m_g, static_cast<RealType>(m_hi), k);
+    }
+
+    /// Fills `out` with random numbers in the desired range
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        namespace d = detail::uniform_real_distribution;
+
+        auto const                                             dist = index_distribution();
+        std::array<index_type, detail::generate_n::batch_size> ks{};
+        d::visit_kind(m_kind,
+                      [&](auto kind)
+                      {
+                          for (std::size_t i = 0; i < out.size(); i += ks.size())
+                          {
+                              auto const chunk = out.subspan(i, std::min(ks.size(), out.size() - i));
+                              auto const k     = std::span{ks}.first(chunk.size());
+                              dist.generate(g, k);
+                              d::map([](auto... args) { return d::gen(decltype(kind)::value, args...); },
+                                     m_a,
+                                     m_b,
+                                     m_g,
+                                     static_cast<RealType>(m_hi),
+                                     std::span<index_type const>{k},
+                                     chunk);
+                          }
+                      });
+    }
+
+    /// Returns the `a` parameter the distribution was constructed with.
+    [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_a; }
+    /// Returns the `b` parameter the distribution was constructed with.
+    [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_b; }
+    /// Returns the minimum potentially generated value.
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type
+    {
+        return detail::uniform_real_distribution::min_value(m_kind, m_a, m_b, m_g, m_hi);
+    }
+    /// Returns the maximum potentially generated value.
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type
+    {
+        return detail::uniform_real_distribution::max_value(m_kind, m_a, m_b, m_g, m_hi);
+    }
+    /// Returns the smallest difference two generated values may have.
+    [[nodiscard]] constexpr auto gamma() const noexcept -> result_type { return m_g; }
+    /// Returns the amount of values that can be generated.
+    [[nodiscard]] constexpr auto num_unique_values() const noexcept -> std::size_t
+    {
+        namespace d = detail::uniform_real_distribution;
+        return d::last_index<RealType>(m_kind, m_hi) - d::first_index<RealType>(m_kind);
+    }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(compact_uniform_real_distribution const& lhs,
+                                     compact_uniform_real_distribution const& rhs) noexcept -> bool = default;
+
+  private:
+    template<random_number_distribution D>
+    friend class distribution_array;
+
+    using index_type = detail::uniform_real_distribution::index_type<RealType>;
+
+    static constexpr int kind_bits = 3;
+
+    constexpr compact_uniform_real_distribution(RealType a, RealType b, bool a_exclusive, bool b_exclusive) noexcept
+        : m_a(a)
+        , m_b(b)
+        , m_g(detail::uniform_real_distribution::compute_gamma(a, b))
+        , m_hi(m_g > 0 ? detail::uniform_real_distribution::ceilint(a, b, m_g) : 0)
+        , m_kind(detail::uniform_real_distribution::make_kind(a_exclusive, b_exclusive, a, b))
+    {
+        assert(m_b - m_a <= std::numeric_limits<RealType>::max());
+    }
+
+    // Restores a distribution from its members, as stored by `distribution_array`.
+    constexpr compact_uniform_real_distribution(RealType a, RealType b, RealType g, std::size_t hi,
+                                                unsigned kind) noexcept
+        : m_a(a)
+        , m_b(b)
+        , m_g(g)
+        , m_hi(hi)
+        , m_kind(kind)
+    {
+    }
+
+    [[nodiscard]] constexpr auto index_distribution() const noexcept -> uniform_int_distribution<index_type>
+    {
+        namespace d = detail::uniform_real_distribution;
+        return {inclusive{d::first_index<RealType>(m_kind)}, inclusive{d::last_index<RealType>(m_kind, m_hi)}};
+    }
+
+    RealType   m_a;
+    RealType   m_b;
+    RealType   m_g;
+    index_type m_hi : std::numeric_limits<index_type>::digits - kind_bits;
+    index_type m_kind : kind_bits;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_COMPACT_UNIFORM_REAL_DISTRIBUTION_HPP
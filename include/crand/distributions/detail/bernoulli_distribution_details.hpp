@@ -0,0 +1,60 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_BERNOULLI_DISTRIBUTION_DETAILS_HPP
+#define CONSTEXPR_RANDOM_BERNOULLI_DISTRIBUTION_DETAILS_HPP
+
+#include "crand/concepts/random_bit_source.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::bernoulli_distribution
+{
+/// Returns `true` with probability `p` by comparing the binary expansion of `p` with a uniform random number in [0, 1)
+/// whose digits are drawn in chunks of 16 bits.
+///
+/// The comparison is decided by the first differing chunk, so almost always only 16 bits are consumed. Scaling by a
+/// power of two and subtracting the integral part are exact in floating point, thus the result is exact for every
+/// representable `p`.
+template<random_bit_source G>
+constexpr auto compare_bits(G& g, double p) -> bool
+{
+    constexpr std::size_t chunk_bits = 16;
+    constexpr double      chunk_size = 1u << chunk_bits;
+
+    while (p > 0)
+    {
+        p *= chunk_size;
+        auto const digits = static_cast<std::uint32_t>(p);
+        p -= digits;
+        auto const random_digits = static_cast<std::uint32_t>(g.bits(chunk_bits));
+        if (random_digits != digits)
+            return random_digits < digits;
+    }
+    return false;
+}
+} // namespace crand::detail::bernoulli_distribution
+
+#endif // CONSTEXPR_RANDOM_BERNOULLI_DISTRIBUTION_DETAILS_HPP
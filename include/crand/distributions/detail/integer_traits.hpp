@@ -0,0 +1,89 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_INTEGER_TRAITS_HPP
+#define CONSTEXPR_RANDOM_INTEGER_TRAITS_HPP
+
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace crand::detail
+{
+#if defined(__SIZEOF_INT128__)
+__extension__ using int128_t  = __int128;
+__extension__ using uint128_t = unsigned __int128;
+
+/// True for the 128 bit integer types provided as a compiler extension. Unless GNU extensions are enabled, the
+/// standard library doesn't consider them integral.
+template<typename T>
+inline constexpr bool is_int128_v = std::same_as<std::remove_cv_t<T>, int128_t>
+                                    || std::same_as<std::remove_cv_t<T>, uint128_t>;
+#else
+template<typename T>
+inline constexpr bool is_int128_v = false;
+#endif
+
+/// Integer types, including the 128 bit integer types if supported by the compiler.
+template<typename T>
+concept integer = std::integral<T> || is_int128_v<T>;
+
+/// Like `std::make_unsigned`, but also supports the 128 bit integer types.
+template<integer T>
+struct make_unsigned : std::make_unsigned<T>
+{
+};
+#if defined(__SIZEOF_INT128__)
+template<>
+struct make_unsigned<int128_t>
+{
+    using type = uint128_t;
+};
+template<>
+struct make_unsigned<uint128_t>
+{
+    using type = uint128_t;
+};
+#endif
+template<integer T>
+using make_unsigned_t = typename make_unsigned<T>::type;
+
+/// Like `std::bit_width`, but also supports the 128 bit integer types.
+template<integer T>
+    requires std::same_as<T, make_unsigned_t<T>>
+constexpr auto bit_width(T x) noexcept -> std::size_t
+{
+    if constexpr (is_int128_v<T>)
+    {
+        auto const hi = static_cast<unsigned long long>(x >> 64u);
+        return hi != 0 ? 64 + std::bit_width(hi) : std::bit_width(static_cast<unsigned long long>(x));
+    }
+    else
+        return std::bit_width(x);
+}
+} // namespace crand::detail
+
+#endif // CONSTEXPR_RANDOM_INTEGER_TRAITS_HPP
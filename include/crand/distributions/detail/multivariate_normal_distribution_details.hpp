@@ -0,0 +1,68 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_DETAILS_HPP
+#define CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_DETAILS_HPP
+
+#include <array>
+#include <concepts>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace crand::detail::multivariate_normal_distribution
+{
+template<typename T, std::size_t N>
+using matrix = std::array<std::array<T, N>, N>;
+
+/// Returns the lower triangular matrix `L` with `L * L^T == a` (Cholesky-Banachiewicz).
+///
+/// # Preconditions
+/// Behavior is undefined if `a` isn't symmetric positive-definite.
+template<std::floating_point T, std::size_t N>
+constexpr auto cholesky(matrix<T, N> const& a) noexcept -> matrix<T, N>
+{
+    matrix<T, N> l{};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            T sum = a[i][j];
+            for (std::size_t k = 0; k < j; ++k)
+                sum -= l[i][k] * l[j][k];
+            if (i == j)
+            {
+                assert(sum > 0);
+                l[i][i] = std::sqrt(sum);
+            }
+            else
+                l[i][j] = sum / l[j][j];
+        }
+    }
+    return l;
+}
+} // namespace crand::detail::multivariate_normal_distribution
+
+#endif // CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_DETAILS_HPP
@@ -0,0 +1,103 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_DETAILS_HPP
+#define CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_DETAILS_HPP
+
+#include <array>
+#include <concepts>
+#include <limits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::static_discrete_distribution
+{
+/// Returns the sum of `weights`, or `0` if it overflows.
+template<std::size_t N>
+constexpr auto total_weight(std::array<std::uint64_t, N> const& weights) noexcept -> std::uint64_t
+{
+    std::uint64_t total = 0;
+    for (auto const w : weights)
+    {
+        if (w > std::numeric_limits<std::uint64_t>::max() - total)
+            return 0;
+        total += w;
+    }
+    return total;
+}
+
+/// Returns the index of the last non-zero weight.
+template<std::size_t N>
+constexpr auto last_nonzero(std::array<std::uint64_t, N> const& weights) noexcept -> std::size_t
+{
+    std::size_t last = 0;
+    for (std::size_t i = 0; i < N; ++i)
+        if (weights[i] != 0)
+            last = i;
+    return last;
+}
+
+/// Cumulative thresholds for sampling with words of type `UInt`.
+///
+/// With `W` the total weight and `q = floor(2^w / W)`, outcome `i` is chosen for draws in
+/// [`q * (w_0 + ... + w_{i-1})`, `q * (w_0 + ... + w_i)`), and draws of at least `q * W` are rejected. Every outcome
+/// therefore covers exactly `q * w_i` values, which makes sampling exact.
+template<std::unsigned_integral UInt, std::size_t M>
+struct threshold_table
+{
+    /// `thresholds[i]` is the first draw mapping to an outcome greater than `i`. Only outcomes up to the last non-zero
+    /// weight are represented, so every threshold is less than `2^w`.
+    std::array<UInt, M> thresholds;
+    /// Draws of at least `limit` are rejected, unless `W` divides `2^w`.
+    UInt limit;
+    /// Whether `W` divides `2^w`, in which case no draw is rejected.
+    bool exact;
+};
+
+template<std::unsigned_integral UInt, std::size_t M, std::size_t N>
+constexpr auto make_threshold_table(std::array<std::uint64_t, N> const& weights) noexcept -> threshold_table<UInt, M>
+{
+    // The arithmetic is done in 64 bits, so totals of exactly `2^w` are supported for narrower words.
+    constexpr std::uint64_t max   = std::numeric_limits<UInt>::max();
+    auto const              total = total_weight(weights);
+
+    threshold_table<UInt, M> table{};
+    table.exact = max % total == total - 1;
+    // If `total` is 1 and words are 64 bits wide, this wraps around to 0; all cumulative weights below the last
+    // non-zero weight are 0 then.
+    auto const q = max / total + (table.exact ? 1 : 0);
+    table.limit  = static_cast<UInt>(total * q);
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < M; ++i)
+    {
+        cumulative += weights[i];
+        table.thresholds[i] = static_cast<UInt>(cumulative * q);
+    }
+    return table;
+}
+} // namespace crand::detail::static_discrete_distribution
+
+#endif // CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_DETAILS_HPP
@@ -0,0 +1,44 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STRUCTURE_OF_ARRAYS_HPP
+#define CONSTEXPR_RANDOM_STRUCTURE_OF_ARRAYS_HPP
+
+#include <array>
+#include <span>
+
+#include <cstddef>
+
+namespace crand::detail
+{
+/// Writes `point` to column `j` of the `D` rows of length `m` in `out`.
+template<typename T, std::size_t D>
+constexpr void scatter(std::array<T, D> const& point, std::span<T> out, std::size_t m, std::size_t j) noexcept
+{
+    for (std::size_t i = 0; i < D; ++i)
+        out[i * m + j] = point[i];
+}
+} // namespace crand::detail
+
+#endif // CONSTEXPR_RANDOM_STRUCTURE_OF_ARRAYS_HPP
@@ -0,0 +1,68 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_DETAILS_HPP
+#define CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_DETAILS_HPP
+
+#include <concepts>
+#include <numbers>
+
+#include <cmath>
+
+namespace crand::detail::truncated_normal_distribution
+{
+/// Proposal used to sample a standard normal restricted to [alpha, beta].
+enum class method : unsigned char
+{
+    /// Standard normal proposals, accepted if they fall into the interval. Used for wide intervals containing 0.
+    normal,
+    /// Uniform proposals in the interval, accepted with probability proportional to the density.
+    uniform,
+    /// Exponential proposals shifted to `alpha`, for intervals in the positive tail (Robert, 1995).
+    exponential,
+};
+
+/// Returns the optimal rate of the exponential proposal for the tail starting at `alpha`.
+template<std::floating_point T>
+constexpr auto exponential_rate(T alpha) noexcept -> T
+{
+    return (alpha + std::sqrt(alpha * alpha + 4)) / 2;
+}
+
+/// Chooses the proposal with the higher acceptance rate for [alpha, beta], where `alpha < beta` and `beta > 0`.
+template<std::floating_point T>
+constexpr auto select_method(T alpha, T beta) noexcept -> method
+{
+    if (alpha <= 0)
+        return beta - alpha >= std::sqrt(2 * std::numbers::pi_v<T>) ? method::normal : method::uniform;
+
+    // Robert's criterion: The uniform proposal is more efficient if the interval is narrower than this
+    auto const root = std::sqrt(alpha * alpha + 4);
+    auto const width_limit =
+        2 * std::sqrt(std::numbers::e_v<T>) / (alpha + root) * std::exp((alpha * alpha - alpha * root) / 4);
+    return beta - alpha < width_limit ? method::uniform : method::exponential;
+}
+} // namespace crand::detail::truncated_normal_distribution
+
+#endif // CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_DETAILS_HPP
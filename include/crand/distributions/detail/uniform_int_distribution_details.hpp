@@ -25,18 +25,19 @@
 #ifndef CONSTEXPR_RANDOM_UNIFORM_INT_DISTRIBUTION_DETAILS_HPP
 #define CONSTEXPR_RANDOM_UNIFORM_INT_DISTRIBUTION_DETAILS_HPP
 
-#include <bit>
-#include <type_traits>
+#include "integer_traits.hpp"
 
 #include <cstdint>
 
 namespace crand::detail::uniform_int_distribution
 {
-template<typename T>
+/// Returns the number of bits needed to represent `b - a`, but at least 1.
+template<integer T>
 constexpr auto range_bit_width(T a, T b) noexcept -> std::uint8_t
 {
-    auto const range = (a == b) ? 1 : b - a;
-    return std::bit_width<std::make_unsigned_t<T>>(range);
+    using uint_t     = make_unsigned_t<T>;
+    auto const range = static_cast<uint_t>(static_cast<uint_t>(b) - static_cast<uint_t>(a));
+    return static_cast<std::uint8_t>(range == 0 ? 1 : detail::bit_width(range));
 }
 } // namespace crand::detail::uniform_int_distribution
 
@@ -25,62 +25,279 @@
 #ifndef CONSTEXPR_RANDOM_UNIFORM_REAL_DISTRIBUTION_DETAILS_HPP
 #define CONSTEXPR_RANDOM_UNIFORM_REAL_DISTRIBUTION_DETAILS_HPP
 
+#include "crand/engines/detail/cpu_dispatch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <climits>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace crand::detail::uniform_real_distribution
 {
+// Floating point types laid out like the IEEE-754 binary interchange formats, i.e. a sign bit, a biased exponent and a
+// mantissa with an implicit leading bit, filling all bits of an unsigned integer of the same size. Besides `float` and
+// `double` this includes `std::float16_t` and `std::bfloat16_t`, but not the x87 80-bit `long double`.
+template<typename T>
+concept binary_interchange
+    = std::numeric_limits<T>::radix == 2 && std::numeric_limits<T>::has_infinity
+   && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+   && sizeof(T) * CHAR_BIT
+          == std::numeric_limits<T>::digits
+                 + std::bit_width(static_cast<unsigned>(std::numeric_limits<T>::max_exponent
+                                                        - std::numeric_limits<T>::min_exponent + 2));
+
+template<typename T>
+using bits_type = std::conditional_t<sizeof(T) == 2,
+                                     std::uint16_t,
+                                     std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>;
+
+// The index of a grid point. A range holds at most `2^(digits + 1) + 1` grid points, so types with few digits get by
+// with 32-bit indices and cheaper integer to floating point conversions.
+template<typename T>
+using index_type = std::conditional_t<std::numeric_limits<T>::digits + 2 <= 32, std::uint32_t, std::size_t>;
+
+// The width of the lanes `generate_packed` splits engine words into: the smallest of 16, 32 and 64 bits that holds any
+// index.
+template<typename T>
+inline constexpr std::size_t lane_bits = std::bit_ceil(std::max<std::size_t>(std::numeric_limits<T>::digits + 2, 16));
+
+// A finite, non-negative `x` decomposed into `significand * 2^exponent`.
+struct decomposed
+{
+    std::uint64_t significand;
+    int           exponent;
+};
+template<binary_interchange T>
+constexpr auto decompose(T x) noexcept -> decomposed
+{
+    constexpr int  mantissa_bits = std::numeric_limits<T>::digits - 1;
+    constexpr int  min_exponent  = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+    constexpr auto mantissa_mask = (bits_type<T>{1} << mantissa_bits) - 1;
+
+    auto const bits     = std::bit_cast<bits_type<T>>(x);
+    auto const biased   = static_cast<int>(bits >> mantissa_bits);
+    auto const mantissa = static_cast<std::uint64_t>(bits & mantissa_mask);
+    return (biased == 0) ? decomposed{mantissa, min_exponent}
+                         : decomposed{mantissa | (std::uint64_t{1} << mantissa_bits), min_exponent + biased - 1};
+}
+// `floor(x / 2^e)` and `ceil(x / 2^e)` of a decomposed value, computed with shifts only.
+constexpr auto shift_floor(decomposed x, int e) noexcept -> std::int64_t
+{
+    if (x.exponent >= e)
+        return static_cast<std::int64_t>(x.significand << (x.exponent - e));
+    auto const shift = e - x.exponent;
+    return shift < 64 ? static_cast<std::int64_t>(x.significand >> shift) : 0;
+}
+constexpr auto shift_ceil(decomposed x, int e) noexcept -> std::int64_t
+{
+    if (x.exponent >= e)
+        return static_cast<std::int64_t>(x.significand << (x.exponent - e));
+    auto const shift = e - x.exponent;
+    if (shift >= 64)
+        return x.significand != 0;
+    auto const remainder = x.significand & ((std::uint64_t{1} << shift) - 1);
+    return static_cast<std::int64_t>((x.significand >> shift) + (remainder != 0));
+}
+/// Checks whether `s` is the exact sum of `x` and `y`, using the error term of Knuth's TwoSum.
+template<typename T>
+constexpr auto is_exact_sum(T x, T y, T s) noexcept -> bool
+{
+    if (x + y != s)
+        return false;
+    auto const y_virtual = s - x;
+    return (x - (s - y_virtual)) + (y - y_virtual) == 0;
+}
+/// Computes `ceil((b - a) / g)` exactly, where `g` is the value returned by `compute_gamma(a, b)`.
+///
+/// For IEEE-754 `float` and `double` the bounds are decomposed into integer significands and exponents; as `g` is a
+/// power of two, the quotients reduce to shifts and the result is exact without any floating point division. Other
+/// types use the error-compensated division by Goualard.
 template<typename T>
-constexpr auto ceilint(T a, T b, T g) noexcept -> T
+constexpr auto ceilint(T a, T b, T g) noexcept -> std::size_t
 {
-    auto const s   = b / g - a / g;
-    auto const eps = (std::abs(a) <= std::abs(b)) ? -a / g - (s - b / g) : b / g - (s + a / g);
-    auto const si  = std::ceil(s);
-    return (s != si) ? si : si + (eps > 0);
+    if constexpr (binary_interchange<T>)
+    {
+        // At least one of the bounds is a multiple of g, so ceil(b/g - a/g) == ceil(b/g) - floor(a/g).
+        auto const [g_significand, g_exponent] = decompose(g);
+        auto const e   = g_exponent + std::countr_zero(g_significand);
+        auto const q_b = std::signbit(b) ? -shift_floor(decompose(-b), e) : shift_ceil(decompose(b), e);
+        auto const q_a = std::signbit(a) ? -shift_ceil(decompose(-a), e) : shift_floor(decompose(a), e);
+        return static_cast<std::size_t>(q_b - q_a);
+    }
+    else
+    {
+        auto const s   = b / g - a / g;
+        auto const eps = (std::abs(a) <= std::abs(b)) ? -a / g - (s - b / g) : b / g - (s + a / g);
+        auto const si  = std::ceil(s);
+        return static_cast<std::size_t>((s != si) ? si : si + (eps > 0));
+    }
 }
+/// Computes the distance between the bound of larger magnitude and its neighbour towards the other bound.
+///
+/// For IEEE-754 `float` and `double` the neighbour is found by decrementing the representation of the magnitude, which
+/// avoids the `long double` round trip of `std::nexttoward`; the subtraction is exact by Sterbenz' lemma.
 template<typename T>
 constexpr auto compute_gamma(T a, T b) noexcept -> T
 {
-    return std::abs(a) <= std::abs(b) ? b - std::nexttoward(b, a) : std::nexttoward(a, b) - a;
+    if constexpr (binary_interchange<T>)
+    {
+        if (a == b)
+            return T{0};
+        auto const m = std::max(std::abs(a), std::abs(b));
+        return m - std::bit_cast<T>(static_cast<bits_type<T>>(std::bit_cast<bits_type<T>>(m) - 1));
+    }
+    else
+    {
+        return std::abs(a) <= std::abs(b) ? b - std::nexttoward(b, a) : std::nexttoward(a, b) - a;
+    }
 }
 template<typename T>
-constexpr auto gen_inclusive_inclusive_loe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_inclusive_inclusive_loe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return (k == hi) ? a : b - k * g;
 }
 template<typename T>
-constexpr auto gen_inclusive_inclusive_nloe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_inclusive_inclusive_nloe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return (k == hi) ? b : a + k * g;
 }
 template<typename T>
-constexpr auto gen_exclusive_inclusive_loe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_exclusive_inclusive_loe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return b - k * g;
 }
 template<typename T>
-constexpr auto gen_exclusive_inclusive_nloe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_exclusive_inclusive_nloe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return (k == hi - 1) ? b : a + (k + 1) * g;
 }
 template<typename T>
-constexpr auto gen_inclusive_exclusive_loe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_inclusive_exclusive_loe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return (k == hi) ? a : b - k * g;
 }
 template<typename T>
-constexpr auto gen_inclusive_exclusive_nloe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_inclusive_exclusive_nloe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return a + (k - 1) * g;
 }
 template<typename T>
-constexpr auto gen_exclusive_exclusive_loe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_exclusive_exclusive_loe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return b - k * g;
 }
 template<typename T>
-constexpr auto gen_exclusive_exclusive_nloe(T a, T b, T g, T hi, std::size_t k) noexcept -> T
+constexpr auto gen_exclusive_exclusive_nloe(T a, T b, T g, T hi, index_type<T> k) noexcept -> T
 {
     return a + k * g;
 }
+
+// The kind of a distribution packed into three bits, for representations that can't afford a function pointer: whether
+// `a` and `b` are exclusive, and whether `a` is less than or equal to `b` in magnitude.
+inline constexpr unsigned a_exclusive = 1;
+inline constexpr unsigned b_exclusive = 2;
+inline constexpr unsigned loe         = 4;
+
+template<typename T>
+constexpr auto make_kind(bool a_is_exclusive, bool b_is_exclusive, T a, T b) noexcept -> unsigned
+{
+    return (a_is_exclusive ? a_exclusive : 0) | (b_is_exclusive ? b_exclusive : 0)
+         | (std::abs(a) <= std::abs(b) ? loe : 0);
+}
+// The range of indices drawn for a distribution of the given kind.
+template<typename T>
+constexpr auto first_index(unsigned kind) noexcept -> index_type<T>
+{
+    return (kind & b_exclusive) ? 1 : 0;
+}
+template<typename T>
+constexpr auto last_index(unsigned kind, std::size_t hi) noexcept -> index_type<T>
+{
+    return static_cast<index_type<T>>((kind & a_exclusive) ? hi - 1 : hi);
+}
+// The smallest and largest values a distribution of the given kind generates.
+template<typename T>
+constexpr auto min_value(unsigned kind, T a, T b, T g, std::size_t hi) noexcept -> T
+{
+    if (!(kind & a_exclusive))
+        return a;
+    return (kind & loe) ? b - (hi - 1) * g : a + g;
+}
+template<typename T>
+constexpr auto max_value(unsigned kind, T a, T b, T g, std::size_t hi) noexcept -> T
+{
+    if (!(kind & b_exclusive))
+        return b;
+    return (kind & loe) ? b - g : a + (hi - 1) * g;
+}
+// Maps the index `k` to a value, like the generator function selected for the kind.
+template<typename T>
+constexpr auto gen(unsigned kind, T a, T b, T g, T hi, index_type<T> k) noexcept -> T
+{
+    switch (kind)
+    {
+    case loe:
+        return gen_inclusive_inclusive_loe(a, b, g, hi, k);
+    case 0:
+        return gen_inclusive_inclusive_nloe(a, b, g, hi, k);
+    case loe | a_exclusive:
+        return gen_exclusive_inclusive_loe(a, b, g, hi, k);
+    case a_exclusive:
+        return gen_exclusive_inclusive_nloe(a, b, g, hi, k);
+    case loe | b_exclusive:
+        return gen_inclusive_exclusive_loe(a, b, g, hi, k);
+    case b_exclusive:
+        return gen_inclusive_exclusive_nloe(a, b, g, hi, k);
+    case loe | a_exclusive | b_exclusive:
+        return gen_exclusive_exclusive_loe(a, b, g, hi, k);
+    default:
+        return gen_exclusive_exclusive_nloe(a, b, g, hi, k);
+    }
+}
+// Calls `f` with the kind as a compile-time constant, so that `gen` can be resolved outside of a loop.
+template<typename F>
+constexpr void visit_kind(unsigned kind, F&& f)
+{
+    [&]<unsigned... Kinds>(std::integer_sequence<unsigned, Kinds...>)
+    { (void)((kind == Kinds ? (f(std::integral_constant<unsigned, Kinds>{}), true) : false) || ...); }
+    (std::make_integer_sequence<unsigned, 8>{});
+}
+
+// Maps the indices `ks` to values in `out` through `gen(a, b, g, hi, k)`. The values are independent of each other, so
+// for the extended instruction sets, whole blocks of them are computed with vector instructions.
+template<cpu_dispatch::isa Target, typename T, typename Gen>
+constexpr void map_kernel(Gen gen, T a, T b, T g, T hi, std::span<index_type<T> const> ks, std::span<T> out) noexcept
+{
+    if constexpr (Target != cpu_dispatch::isa::portable)
+    {
+        constexpr std::size_t block = cpu_dispatch::block_size;
+        for (; out.size() >= block; out = out.subspan(block), ks = ks.subspan(block))
+            for (std::size_t j = 0; j < block; ++j)
+                out[j] = gen(a, b, g, hi, ks[j]);
+    }
+    for (std::size_t j = 0; j < out.size(); ++j)
+        out[j] = gen(a, b, g, hi, ks[j]);
+}
+// Maps the indices `ks` to values in `out` through `gen(a, b, g, hi, k)`, using the kernel for the instruction set of
+// the CPU. `gen` should be a stateless function object, so that it is known inside of the kernel.
+template<typename T, typename Gen>
+constexpr void map(Gen gen, T a, T b, T g, T hi, std::span<index_type<T> const> ks, std::span<T> out) noexcept
+{
+    if consteval
+    {
+        map_kernel<cpu_dispatch::isa::portable>(gen, a, b, g, hi, ks, out);
+    }
+    else
+    {
+        cpu_dispatch::invoke([&](auto target)
+                             { map_kernel<decltype(target)::value>(gen, a, b, g, hi, ks, out); });
+    }
+}
 } // namespace crand::detail::uniform_real_distribution
 #endif // CONSTEXPR_RANDOM_UNIFORM_REAL_DISTRIBUTION_DETAILS_HPP
@@ -0,0 +1,212 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_DISTRIBUTION_ARRAY_HPP
+#define CONSTEXPR_RANDOM_DISTRIBUTION_ARRAY_HPP
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/compact_uniform_real_distribution.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+#include "crand/distributions/detail/uniform_real_distribution_details.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// A sequence of distributions of the same type that are sampled together, one value per distribution.
+///
+/// # Notes
+/// - The primary template stores the distributions as they are. The specialization for
+///   `compact_uniform_real_distribution` stores each member in a column of its own (structure of arrays), so that a
+///   pass over all distributions only touches the members it needs.
+/// - `distribution_array` is a container of distributions, not a distribution itself.
+template<random_number_distribution D>
+class distribution_array
+{
+  public:
+    using distribution_type = D;
+    using result_type       = typename D::result_type;
+
+    /// Constructs an empty array.
+    constexpr distribution_array() = default;
+
+    /// Constructs an array holding the distributions in `ds`.
+    constexpr explicit distribution_array(std::span<D const> ds)
+        : m_ds(ds.begin(), ds.end())
+    {
+    }
+
+    /// Appends a distribution.
+    constexpr void push_back(D const& d) { m_ds.push_back(d); }
+    /// Reserves storage for `n` distributions.
+    constexpr void reserve(std::size_t n) { m_ds.reserve(n); }
+    /// Returns the number of distributions.
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return m_ds.size(); }
+    /// Returns a copy of the `i`-th distribution.
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const -> D { return m_ds[i]; }
+
+    /// Samples each distribution once
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill, one value per distribution
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size() != size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `d(g)` to `out[i]` for the `i`-th distribution `d`, in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out)
+    {
+        assert(out.size() == size());
+        for (std::size_t i = 0; i < out.size(); ++i)
+            out[i] = m_ds[i](g);
+    }
+
+    /// Compares two arrays by the distributions they hold.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(distribution_array const&, distribution_array const&) -> bool = default;
+
+  private:
+    std::vector<D> m_ds;
+};
+
+/// A sequence of `compact_uniform_real_distribution`s, stored as a structure of arrays.
+///
+/// # Notes
+/// Sampling all distributions first draws the grid indices, which only needs the number of values and the kind of
+/// each distribution, and then maps them to values in a second pass over the bounds and gamma.
+template<std::floating_point RealType>
+class distribution_array<compact_uniform_real_distribution<RealType>>
+{
+  public:
+    using distribution_type = compact_uniform_real_distribution<RealType>;
+    using result_type       = RealType;
+
+    /// Constructs an empty array.
+    constexpr distribution_array() = default;
+
+    /// Constructs an array holding the distributions in `ds`.
+    constexpr explicit distribution_array(std::span<distribution_type const> ds)
+    {
+        reserve(ds.size());
+        for (auto const& d : ds)
+            push_back(d);
+    }
+
+    /// Appends a distribution.
+    constexpr void push_back(distribution_type const& d)
+    {
+        m_a.push_back(d.m_a);
+        m_b.push_back(d.m_b);
+        m_g.push_back(d.m_g);
+        m_hi.push_back(d.m_hi);
+        m_kind.push_back(static_cast<std::uint8_t>(d.m_kind));
+    }
+    /// Reserves storage for `n` distributions.
+    constexpr void reserve(std::size_t n)
+    {
+        m_a.reserve(n);
+        m_b.reserve(n);
+        m_g.reserve(n);
+        m_hi.reserve(n);
+        m_kind.reserve(n);
+    }
+    /// Returns the number of distributions.
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t { return m_a.size(); }
+    /// Returns a copy of the `i`-th distribution.
+    [[nodiscard]] constexpr auto operator[](std::size_t i) const -> distribution_type
+    {
+        return distribution_type(m_a[i], m_b[i], m_g[i], m_hi[i], m_kind[i]);
+    }
+
+    /// Samples each distribution once
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill, one value per distribution
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size() != size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `d(g)` to `out[i]` for the `i`-th distribution `d`, in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        namespace d = detail::uniform_real_distribution;
+        assert(out.size() == size());
+
+        std::array<index_type, detail::generate_n::batch_size> ks{};
+        for (std::size_t i = 0; i < out.size(); i += ks.size())
+        {
+            auto const n = std::min(ks.size(), out.size() - i);
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                auto const kind = m_kind[i + j];
+                auto const dist = uniform_int_distribution<index_type>(
+                    inclusive{d::first_index<RealType>(kind)}, inclusive{d::last_index<RealType>(kind, m_hi[i + j])});
+                ks[j] = dist(g);
+            }
+            for (std::size_t j = 0; j < n; ++j)
+                out[i + j] = d::gen(m_kind[i + j], m_a[i + j], m_b[i + j], m_g[i + j],
+                                    static_cast<RealType>(m_hi[i + j]), ks[j]);
+        }
+    }
+
+    /// Compares two arrays by the distributions they hold.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(distribution_array const&, distribution_array const&) -> bool = default;
+
+  private:
+    using index_type = detail::uniform_real_distribution::index_type<RealType>;
+
+    std::vector<RealType>     m_a;
+    std::vector<RealType>     m_b;
+    std::vector<RealType>     m_g;
+    std::vector<index_type>   m_hi;
+    std::vector<std::uint8_t> m_kind;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_DISTRIBUTION_ARRAY_HPP
@@ -0,0 +1,104 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_GENERATE_N_HPP
+#define CONSTEXPR_RANDOM_GENERATE_N_HPP
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include <cstddef>
+
+namespace crand
+{
+/// Writes `n` values produced by `d` to `out`.
+///
+/// # Parameters
+/// - d
+///     An object satisfying `random_number_distribution`
+/// - g
+///     An object satisfying `uniform_random_bit_generator`
+/// - out
+///     The beginning of the destination range
+/// - n
+///     The number of values to generate
+///
+/// # Return Value
+///     An iterator one past the last value written.
+///
+/// # Complexity
+/// Linear in `n`.
+///
+/// # Notes
+/// - Equivalent to assigning `d(g)` to `*out++` `n` times, i.e. the values and the states of `d` and `g` afterwards
+///   are the same.
+/// - If `d` satisfies `batch_random_number_distribution`, its `generate` member function is used: Directly on the
+///   destination if `out` is a contiguous iterator, and through an intermediate buffer otherwise.
+template<typename D, uniform_random_bit_generator G, std::input_or_output_iterator O>
+    requires random_number_distribution<std::remove_const_t<D>>
+             && requires(O out, typename std::remove_const_t<D>::result_type value) { *out++ = value; }
+constexpr auto generate_n(D& d, G& g, O out, std::size_t n) -> O
+{
+    using result_type = typename std::remove_const_t<D>::result_type;
+
+    if constexpr (requires(std::span<result_type> s) { d.generate(g, s); })
+    {
+        if constexpr (std::contiguous_iterator<O> && std::same_as<std::iter_reference_t<O>, result_type&>)
+        {
+            d.generate(g, std::span<result_type>{std::to_address(out), n});
+            return out + static_cast<std::iter_difference_t<O>>(n);
+        }
+        else
+        {
+            std::array<result_type, detail::generate_n::batch_size> buffer{};
+            while (n > 0)
+            {
+                auto const chunk = std::span{buffer}.first(std::min(n, buffer.size()));
+                d.generate(g, chunk);
+                for (auto const x : chunk)
+                    *out++ = x;
+                n -= chunk.size();
+            }
+            return out;
+        }
+    }
+    else
+    {
+        for (; n > 0; --n)
+            *out++ = d(g);
+        return out;
+    }
+}
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_GENERATE_N_HPP
@@ -0,0 +1,159 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HALF_NORMAL_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_HALF_NORMAL_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+
+#include <concepts>
+#include <limits>
+
+#include <cassert>
+#include <cmath>
+
+namespace crand
+{
+/// Produces half-normal-distributed random numbers, i.e. the absolute values of normal-distributed numbers with mean 0.
+///
+/// # Notes
+/// - `half_normal_distribution` satisfies `random_number_distribution`.
+/// - Equivalent to a `truncated_normal_distribution` with mean 0 restricted to [0, inf), but faster, since every
+///   sample of the underlying normal distribution is used.
+template<std::floating_point RealType = double>
+class half_normal_distribution
+{
+  public:
+    using result_type = RealType;
+
+    /// The parameters of the distribution.
+    class param_type
+    {
+      public:
+        using distribution_type = half_normal_distribution;
+
+        /// Constructs the parameters of a half-normal distribution with the given scale.
+        ///
+        /// # Preconditions
+        /// Behavior is undefined if `sigma <= 0`.
+        constexpr explicit param_type(RealType sigma) noexcept
+            : m_sigma(sigma)
+        {
+            assert(sigma > 0);
+        }
+
+        /// Returns the `sigma` parameter.
+        [[nodiscard]] constexpr auto sigma() const noexcept -> result_type { return m_sigma; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class half_normal_distribution;
+
+        result_type m_sigma;
+    };
+
+    /// Constructs a half-normal distribution with scale 1
+    constexpr half_normal_distribution() noexcept
+        : half_normal_distribution(1.0)
+    {
+    }
+    /// Constructs a half-normal distribution
+    ///
+    /// # Parameters
+    /// - `sigma`
+    ///     The standard deviation of the underlying normal distribution
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `sigma <= 0`.
+    constexpr explicit half_normal_distribution(RealType sigma) noexcept
+        : m_param(sigma)
+    {
+    }
+
+    /// Generates random numbers according to `sigma`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Amortized constant number of invocations of `g()`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) -> result_type
+    {
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random numbers according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Same as `operator()(g)`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) -> result_type
+    {
+        return std::abs(m_normal(g, typename normal_distribution<result_type>::param_type{0.0, p.m_sigma}));
+    }
+
+    /// Returns the `sigma` parameter the distribution was constructed with.
+    constexpr auto sigma() const noexcept -> result_type { return m_param.m_sigma; }
+
+    /// Returns the minimum potentially generated value
+    constexpr auto min() const noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value
+    constexpr auto max() const noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(half_normal_distribution const& lhs, half_normal_distribution const& rhs) noexcept
+        -> bool = default;
+
+  private:
+    param_type                       m_param;
+    normal_distribution<result_type> m_normal;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_HALF_NORMAL_DISTRIBUTION_HPP
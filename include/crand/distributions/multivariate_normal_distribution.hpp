@@ -0,0 +1,276 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/multivariate_normal_distribution_details.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cstddef>
+
+namespace crand
+{
+/// Produces vectors of correlated normal-distributed random numbers.
+///
+/// Vectors are computed as `mean + L * z`, where `z` is a vector of independent standard normal numbers and `L` the
+/// Cholesky factor of the covariance matrix, which is computed at construction.
+///
+/// # Parameters
+/// - RealType
+///     The type of the vector components
+/// - N
+///     The number of components
+///
+/// # Notes
+/// - As its result type is an array, `multivariate_normal_distribution` doesn't satisfy `random_number_distribution`,
+///   but otherwise provides the same interface.
+/// - `generate` produces many vectors at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t N>
+    requires(N > 0)
+class multivariate_normal_distribution
+{
+  public:
+    using result_type = std::array<RealType, N>;
+    using matrix_type = detail::multivariate_normal_distribution::matrix<RealType, N>;
+
+    /// The parameters of the distribution: the mean vector and the Cholesky factor of the covariance matrix.
+    class param_type
+    {
+      public:
+        using distribution_type = multivariate_normal_distribution;
+
+        /// Constructs the parameters of a multivariate normal distribution, factorizing `covariance`.
+        ///
+        /// # Preconditions
+        /// Behavior is undefined if `covariance` isn't symmetric positive-definite.
+        constexpr param_type(result_type const& mean, matrix_type const& covariance) noexcept
+            : m_mean(mean)
+            , m_cholesky(detail::multivariate_normal_distribution::cholesky(covariance))
+        {
+        }
+
+        /// Returns the `mean` parameter.
+        [[nodiscard]] constexpr auto mean() const noexcept -> result_type const& { return m_mean; }
+        /// Returns the lower triangular Cholesky factor `L` of the covariance matrix.
+        [[nodiscard]] constexpr auto cholesky_factor() const noexcept -> matrix_type const& { return m_cholesky; }
+        /// Returns the covariance matrix, computed as `L * L^T`.
+        [[nodiscard]] constexpr auto covariance() const noexcept -> matrix_type
+        {
+            matrix_type c{};
+            for (std::size_t i = 0; i < N; ++i)
+                for (std::size_t j = 0; j < N; ++j)
+                    for (std::size_t k = 0; k <= std::min(i, j); ++k)
+                        c[i][j] += m_cholesky[i][k] * m_cholesky[j][k];
+            return c;
+        }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class multivariate_normal_distribution;
+
+        result_type m_mean;
+        matrix_type m_cholesky;
+    };
+
+    /// Constructs a distribution with mean 0 and the identity as covariance matrix
+    constexpr multivariate_normal_distribution() noexcept
+        : multivariate_normal_distribution(result_type{}, identity())
+    {
+    }
+    /// Constructs a multivariate normal distribution
+    ///
+    /// # Parameters
+    /// - `mean`
+    ///     The mean vector
+    /// - `covariance`
+    ///     The covariance matrix
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `covariance` isn't symmetric positive-definite.
+    constexpr multivariate_normal_distribution(result_type const& mean, matrix_type const& covariance) noexcept
+        : m_param(mean, covariance)
+    {
+    }
+
+    /// Generates a random vector according to `mean` and `covariance`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random vector.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `N`, and quadratic number of arithmetic operations.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) -> result_type
+    {
+        return (*this)(g, m_param);
+    }
+
+    /// Generates a random vector according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random vector.
+    ///
+    /// # Complexity
+    ///     Same as `operator()(g)`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) -> result_type
+    {
+        result_type z;
+        for (auto& x : z)
+            x = m_normal(g);
+
+        result_type result = p.m_mean;
+        for (std::size_t i = 0; i < N; ++i)
+            for (std::size_t k = 0; k <= i; ++k)
+                result[i] += p.m_cholesky[i][k] * z[k];
+        return result;
+    }
+
+    /// Generates `out.size() / N` random vectors in structure-of-arrays layout
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     `N` consecutive rows of `M = out.size() / N` values each: Component `i` of vector `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `N`.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// - The standard normal numbers are generated row by row through `normal_distribution::generate`, so the vectors
+    ///   differ from those of repeated invocations of `operator()`, but follow the same distribution.
+    /// - The rows are transformed in place, in blocks of columns small enough for all `N` rows of a block to stay in
+    ///   cache. Within a block, each row is a sum of scaled rows, which vectorizes well.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<RealType> out)
+    {
+        generate(g, out, m_param);
+    }
+
+    /// Generates `out.size() / N` random vectors in structure-of-arrays layout according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     `N` consecutive rows of `M = out.size() / N` values each, as for `generate(g, out)`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `N`.
+    ///
+    /// # Complexity
+    ///     Same as `generate(g, out)`.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<RealType> out, param_type const& p)
+    {
+        assert(out.size() % N == 0);
+        auto const m = out.size() / N;
+        m_normal.generate(g, out);
+
+        for (std::size_t begin = 0; begin < m; begin += block_columns)
+        {
+            auto const columns = std::min(block_columns, m - begin);
+            auto const row     = [&](std::size_t i) { return out.subspan(i * m + begin, columns); };
+
+            // Row `i` of the result only depends on rows `0` to `i` of `z`, so going upwards allows working in place
+            for (std::size_t i = N; i-- > 0;)
+            {
+                auto const dst = row(i);
+                for (auto& x : dst)
+                    x = p.m_mean[i] + p.m_cholesky[i][i] * x;
+                for (std::size_t k = 0; k < i; ++k)
+                {
+                    auto const src = row(k);
+                    auto const lik = p.m_cholesky[i][k];
+                    for (std::size_t j = 0; j < columns; ++j)
+                        dst[j] += lik * src[j];
+                }
+            }
+        }
+    }
+
+    /// Returns the `mean` parameter the distribution was constructed with.
+    constexpr auto mean() const noexcept -> result_type const& { return m_param.mean(); }
+    /// Returns the lower triangular Cholesky factor `L` of the covariance matrix.
+    constexpr auto cholesky_factor() const noexcept -> matrix_type const& { return m_param.cholesky_factor(); }
+    /// Returns the covariance matrix, computed as `L * L^T`.
+    constexpr auto covariance() const noexcept -> matrix_type { return m_param.covariance(); }
+
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(multivariate_normal_distribution const& lhs,
+                                     multivariate_normal_distribution const& rhs) noexcept -> bool = default;
+
+  private:
+    // Number of columns transformed at once by `generate`; with 8 byte values, a block of 16 rows takes 32 KiB
+    static constexpr std::size_t block_columns = 256;
+
+    static constexpr auto identity() noexcept -> matrix_type
+    {
+        matrix_type m{};
+        for (std::size_t i = 0; i < N; ++i)
+            m[i][i] = 1;
+        return m;
+    }
+
+    param_type                    m_param;
+    normal_distribution<RealType> m_normal;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
@@ -26,11 +26,15 @@
 #define CONSTEXPR_RANDOM_NORMAL_DISTRIBUTION_HPP
 
 #include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
 #include "crand/distributions/uniform_real_distribution.hpp"
 
+#include <algorithm>
+#include <array>
 #include <concepts>
 #include <limits>
 #include <optional>
+#include <span>
 
 #include <cmath>
 
@@ -46,6 +50,34 @@ class normal_distribution
   public:
     using result_type = RealType;
 
+    /// The parameters of the distribution.
+    class param_type
+    {
+      public:
+        using distribution_type = normal_distribution;
+
+        /// Constructs the parameters of a normal distribution with the given mean and standard deviation.
+        constexpr explicit param_type(RealType mean, RealType stddev = 1.0) noexcept
+            : m_mean(mean)
+            , m_stddev(stddev)
+        {
+        }
+
+        /// Returns the `mean` parameter.
+        [[nodiscard]] constexpr auto mean() const noexcept -> result_type { return m_mean; }
+        /// Returns the `stddev` parameter.
+        [[nodiscard]] constexpr auto stddev() const noexcept -> result_type { return m_stddev; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class normal_distribution;
+
+        result_type m_mean;
+        result_type m_stddev;
+    };
+
     /// Constructs a normal distribution with mean 0 and standard deviation 1
     constexpr normal_distribution() noexcept
         : normal_distribution(0.0)
@@ -59,8 +91,7 @@ class normal_distribution
     /// - `stddev`
     ///     The standard deviation of the normal distribution
     constexpr explicit normal_distribution(RealType mean, RealType stddev = 1.0) noexcept
-        : m_mean(mean)
-        , m_stddev(stddev)
+        : m_param(mean, stddev)
     {
     }
 
@@ -77,13 +108,36 @@ class normal_distribution
     ///     Amortized constant number of invocations of `g()`.
     template<uniform_random_bit_generator G>
     constexpr auto operator()(G& g) -> result_type
+    {
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random numbers according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Amortized constant number of invocations of `g()`.
+    ///
+    /// # Notes
+    /// Values are generated in pairs, the second one is cached as a standard normal value and transformed according to
+    /// the parameters of the next call.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) -> result_type
     {
         // Marsaglia polar method
         if (m_cache)
         {
             result_type const r = m_cache.value();
             m_cache.reset();
-            return r;
+            return r * p.m_stddev + p.m_mean;
         }
 
         result_type u, v, s;
@@ -94,20 +148,92 @@ class normal_distribution
             s = u * u + v * v;
         } while (s == 0 || s >= 1);
         s       = std::sqrt(-2 * std::log(s) / s);
-        m_cache = v * s * m_stddev + m_mean;
-        return u * s * m_stddev + m_mean;
+        m_cache = v * s;
+        return u * s * p.m_stddev + p.m_mean;
+    }
+
+    /// Fills `out` with random numbers according to `mean` and `stddev`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g)` to each element of `out` in order, including which value is left cached.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out)
+    {
+        generate(g, out, m_param);
+    }
+
+    /// Fills `out` with random numbers according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g, p)` to each element of `out` in order, including which value is left
+    /// cached.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out, param_type const& p)
+    {
+        std::size_t i = 0;
+        if (m_cache && !out.empty())
+        {
+            out[i++] = m_cache.value() * p.m_stddev + p.m_mean;
+            m_cache.reset();
+        }
+
+        // Every accepted pair yields two values, so requesting as many pairs as are needed to finish never consumes
+        // more uniforms than the scalar path would.
+        std::array<result_type, 2 * detail::generate_n::batch_size> uv{};
+        while (i < out.size())
+        {
+            auto const pairs = std::min(detail::generate_n::batch_size, (out.size() - i + 1) / 2);
+            auto const chunk = std::span{uv}.first(2 * pairs);
+            s_dist.generate(g, chunk);
+            for (std::size_t j = 0; j < chunk.size(); j += 2)
+            {
+                auto const u = chunk[j];
+                auto const v = chunk[j + 1];
+                auto       s = u * u + v * v;
+                if (s == 0 || s >= 1)
+                    continue;
+                s        = std::sqrt(-2 * std::log(s) / s);
+                out[i++] = u * s * p.m_stddev + p.m_mean;
+                if (i < out.size())
+                    out[i++] = v * s * p.m_stddev + p.m_mean;
+                else
+                    m_cache = v * s;
+            }
+        }
     }
 
     /// Returns the `mean` parameter the distribution was constructed with.
-    constexpr auto mean() const noexcept -> result_type { return m_mean; }
+    constexpr auto mean() const noexcept -> result_type { return m_param.m_mean; }
     /// Returns the `stddev` parameter the distribution was constructed with.
-    constexpr auto stddev() const noexcept -> result_type { return m_stddev; }
+    constexpr auto stddev() const noexcept -> result_type { return m_param.m_stddev; }
 
     /// Returns the minimum potentially generated value
     constexpr auto min() const noexcept -> result_type { return std::numeric_limits<result_type>::lowest(); }
     /// Returns the maximum potentially generated value
     constexpr auto max() const noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
 
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
     /// Compares two distribution objects by their internal state.
     ///
     /// # Notes
@@ -119,8 +245,7 @@ class normal_distribution
     static constexpr uniform_real_distribution<result_type> s_dist{exclusive<result_type>{-1.},
                                                                    exclusive<result_type>{1.}};
 
-    result_type                m_mean;
-    result_type                m_stddev;
+    param_type                 m_param;
     std::optional<result_type> m_cache;
 };
 } // namespace crand
@@ -0,0 +1,131 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SIMPLEX_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_SIMPLEX_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/structure_of_arrays.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cstddef>
+
+namespace crand
+{
+/// Produces points uniformly distributed on the standard simplex, i.e. vectors of `D` non-negative numbers summing to
+/// `1`. This is the Dirichlet distribution with all concentration parameters equal to `1`.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates, e.g. `3` for the triangle with corners (1, 0, 0), (0, 1, 0) and (0, 0, 1)
+///
+/// # Notes
+/// - As its result type is an array, `simplex_distribution` doesn't satisfy `random_number_distribution`, but
+///   otherwise provides the same interface.
+/// - The coordinates are the spacings of `D - 1` sorted uniform numbers in [0, 1), which needs no logarithms.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+/// - As its `operator()` is `const`, creating `constexpr` variables of this type can make sense.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0)
+class simplex_distribution
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Generates a random point on the standard simplex
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random point.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `D`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) const -> result_type
+    {
+        if constexpr (D == 1)
+            return {1};
+        else
+        {
+            std::array<RealType, D - 1> cuts;
+            for (auto& c : cuts)
+                c = s_unit(g);
+            std::ranges::sort(cuts);
+
+            result_type point;
+            point[0] = cuts[0];
+            for (std::size_t i = 1; i < D - 1; ++i)
+                point[i] = cuts[i] - cuts[i - 1];
+            point[D - 1] = 1 - cuts[D - 2];
+            return point;
+        }
+    }
+
+    /// Generates `out.size() / D` random points in structure-of-arrays layout
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<RealType> out) const
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+        for (std::size_t j = 0; j < m; ++j)
+            detail::scatter((*this)(g), out, m, j);
+    }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(simplex_distribution const&, simplex_distribution const&) noexcept
+        -> bool = default;
+
+  private:
+    static constexpr uniform_real_distribution<RealType> s_unit{inclusive<RealType>{0.}, exclusive<RealType>{1.}};
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SIMPLEX_DISTRIBUTION_HPP
@@ -0,0 +1,136 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/static_discrete_distribution_details.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Produces random indices according to integer weights known at compile time.
+///
+/// The probability of index `i` being returned is `Weights[i] / (Weights[0] + ... + Weights[n-1])`. A table of
+/// cumulative integer thresholds is computed at compile time; sampling takes one word from the engine and counts the
+/// thresholds it reaches, without floating point arithmetic and without branching on the outcome.
+///
+/// # Parameters
+/// - Weights
+///     The relative weights of the indices
+///
+/// # Notes
+/// - `static_discrete_distribution` satisfies `random_number_distribution`.
+/// - Sampling is exact: Each index corresponds to exactly `q * Weights[i]` engine words, where `q` is the largest
+///   integer such that `q` times the total weight fits into a word. The remaining words are rejected, which happens
+///   with a probability less than `total / 2^w`.
+/// - The distribution is stateless; all objects of the same type compare equal.
+template<std::uint64_t... Weights>
+    requires(sizeof...(Weights) > 0)
+            && (detail::static_discrete_distribution::total_weight(std::array{Weights...}) > 0)
+class static_discrete_distribution
+{
+    static constexpr std::array<std::uint64_t, sizeof...(Weights)> s_weights{Weights...};
+    static constexpr std::uint64_t s_total = detail::static_discrete_distribution::total_weight(s_weights);
+    static constexpr std::size_t   s_last  = detail::static_discrete_distribution::last_nonzero(s_weights);
+
+    template<typename UInt>
+    static constexpr auto s_table =
+        detail::static_discrete_distribution::make_threshold_table<UInt, s_last>(s_weights);
+
+    // Up to this many thresholds, counting all of them branchlessly beats a binary search.
+    static constexpr std::size_t linear_search_limit = 64;
+
+  public:
+    using result_type = std::size_t;
+
+    /// Generates random indices according to `Weights`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random index.
+    ///
+    /// # Complexity
+    ///     Exactly one invocation of `g()` if the total weight is a power of two, otherwise amortized constant number
+    ///     of invocations of `g()`, almost always one.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) const -> result_type
+    {
+        using engine_int = std::invoke_result_t<G&>;
+        static_assert(s_total - 1 <= std::numeric_limits<engine_int>::max(),
+                      "the total weight must not exceed the number of distinct engine words");
+
+        constexpr auto const& table = s_table<engine_int>;
+
+        engine_int x = g();
+        if constexpr (!table.exact)
+            while (x >= table.limit)
+                x = g();
+
+        if constexpr (table.thresholds.size() <= linear_search_limit)
+        {
+            result_type index = 0;
+            for (auto const t : table.thresholds)
+                index += x >= t ? 1 : 0;
+            return index;
+        }
+        else
+            return static_cast<result_type>(std::ranges::upper_bound(table.thresholds, x) - table.thresholds.begin());
+    }
+
+    /// Returns the probability of each index.
+    static constexpr auto probabilities() noexcept -> std::array<double, sizeof...(Weights)>
+    {
+        std::array<double, sizeof...(Weights)> p{};
+        for (std::size_t i = 0; i < p.size(); ++i)
+            p[i] = static_cast<double>(s_weights[i]) / static_cast<double>(s_total);
+        return p;
+    }
+
+    /// Returns `0`.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the index of the last non-zero weight, which is the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return s_last; }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(static_discrete_distribution const&, static_discrete_distribution const&)
+        -> bool = default;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_STATIC_DISCRETE_DISTRIBUTION_HPP
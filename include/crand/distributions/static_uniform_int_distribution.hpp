@@ -0,0 +1,195 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STATIC_UNIFORM_INT_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_STATIC_UNIFORM_INT_DISTRIBUTION_HPP
+
+#include "crand/concepts/random_bit_source.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+#include "crand/distributions/detail/integer_traits.hpp"
+#include "crand/distributions/detail/uniform_int_distribution_details.hpp"
+#include "crand/distributions/distribution_limits.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/generate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+
+#include <climits>
+#include <cstddef>
+
+namespace crand
+{
+/// Produces uniformly distributed random integers in a range known at compile time.
+///
+/// Produces the same values as `uniform_int_distribution` constructed with `inclusive{Lo}` and `inclusive{Hi}`, but all
+/// parameters of the sampling loop are constants. If the number of values in the range is a power of two, no rejection
+/// is needed and sampling takes a single shift.
+///
+/// # Parameters
+/// - IntType
+///     The type of generated values
+/// - Lo
+///     The lowest potentially generated value
+/// - Hi
+///     The largest potentially generated value
+///
+/// # Notes
+/// - `static_uniform_int_distribution` satisfies `batch_random_number_distribution`.
+/// - The distribution is stateless; all objects of the same type compare equal.
+template<detail::integer IntType, IntType Lo, IntType Hi>
+    requires(Lo <= Hi)
+class static_uniform_int_distribution
+{
+    using uint_t = detail::make_unsigned_t<IntType>;
+
+    // Like `uniform_int_distribution`, a single-element range draws one bit per attempt and rejects ones, so that both
+    // consume the same random bits.
+    static constexpr uint_t      range              = static_cast<uint_t>(Hi) - static_cast<uint_t>(Lo);
+    static constexpr std::size_t range_bits         = detail::uniform_int_distribution::range_bit_width(Lo, Hi);
+    static constexpr bool        power_of_two_range = range != 0 && (range & static_cast<uint_t>(range + 1)) == 0;
+
+  public:
+    using result_type = IntType;
+
+    /// Generates random integers in [`Lo`, `Hi`]
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random integer.
+    ///
+    /// # Complexity
+    ///     Exactly one invocation of `g()` if the number of values in the range is a power of two greater than one and
+    ///     fits into one word of `g`, otherwise amortized constant number of invocations of `g()`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) const -> result_type
+    {
+        using engine_int                  = std::invoke_result_t<G&>;
+        constexpr std::size_t engine_bits = sizeof(engine_int) * CHAR_BIT;
+
+        if constexpr (range_bits > engine_bits)
+            return uniform_int_distribution<IntType>{inclusive{Lo}, inclusive{Hi}}(g);
+        else
+        {
+            auto const draw = [&g]
+            {
+                if constexpr (random_bit_source<G>)
+                    return g.bits(range_bits);
+                else
+                    return static_cast<engine_int>(g() >> (engine_bits - range_bits));
+            };
+
+            engine_int result = draw();
+            if constexpr (!power_of_two_range)
+                while (result > range)
+                    result = draw();
+            return static_cast<result_type>(static_cast<uint_t>(Lo) + static_cast<uint_t>(result));
+        }
+    }
+
+    /// Fills `out` with random integers in [`Lo`, `Hi`]
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// - Equivalent to assigning `(*this)(g)` to each element of `out` in order.
+    /// - If the range fits into a single word, words are drawn from `g` in bulk through `crand::generate`, never more
+    ///   than values remain to be produced. The words are then mapped in a separate loop, which has no branches and
+    ///   constant shifts, so that the compiler can vectorize it.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        using engine_int                  = std::invoke_result_t<G&>;
+        constexpr std::size_t engine_bits = sizeof(engine_int) * CHAR_BIT;
+
+        if constexpr (random_bit_source<G> || range_bits > engine_bits)
+        {
+            for (auto& x : out)
+                x = (*this)(g);
+        }
+        else
+        {
+            constexpr std::size_t shift = engine_bits - range_bits;
+            constexpr auto        map   = [](engine_int r)
+            { return static_cast<result_type>(static_cast<uint_t>(Lo) + static_cast<uint_t>(r)); };
+
+            // As in `uniform_int_distribution::generate`, every candidate is written and only kept if it is accepted
+            std::array<engine_int, detail::generate_n::batch_size> words{};
+            std::size_t                                            i = 0;
+            while (i < out.size())
+            {
+                auto const chunk = std::span{words}.first(std::min(words.size(), out.size() - i));
+                crand::generate(g, chunk);
+                if constexpr (power_of_two_range)
+                {
+                    for (std::size_t j = 0; j < chunk.size(); ++j)
+                        out[i + j] = map(static_cast<engine_int>(chunk[j] >> shift));
+                    i += chunk.size();
+                }
+                else
+                {
+                    for (auto const w : chunk)
+                    {
+                        auto const r = static_cast<engine_int>(w >> shift);
+                        out[i]       = map(r);
+                        i += r <= range ? 1 : 0;
+                    }
+                }
+            }
+        }
+    }
+
+    /// Returns `Lo`.
+    static constexpr auto a() noexcept -> result_type { return Lo; }
+    /// Returns `Hi`.
+    static constexpr auto b() noexcept -> result_type { return Hi; }
+
+    /// Returns the minimum potentially generated value
+    static constexpr auto min() noexcept -> result_type { return Lo; }
+    /// Returns the maximum potentially generated value
+    static constexpr auto max() noexcept -> result_type { return Hi; }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(static_uniform_int_distribution const&, static_uniform_int_distribution const&)
+        -> bool = default;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_STATIC_UNIFORM_INT_DISTRIBUTION_HPP
@@ -0,0 +1,235 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/truncated_normal_distribution_details.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+
+#include <algorithm>
+#include <concepts>
+
+#include <cassert>
+#include <cmath>
+
+namespace crand
+{
+/// Produces normal-distributed random numbers restricted to [a, b].
+///
+/// The distribution is that of a normal distribution conditioned on the result lying in [`a`, `b`]. Unlike rejecting
+/// samples of a `normal_distribution`, the expected number of engine invocations per sample is bounded regardless of
+/// how far the interval lies in the tails.
+///
+/// # Notes
+/// - `truncated_normal_distribution` satisfies `random_number_distribution`.
+/// - Depending on the standardized interval, one of three proposals is chosen at construction (Robert, 1995):
+///   standard normal samples for wide intervals around the mean, uniform samples for narrow intervals, and shifted
+///   exponential samples for intervals in the tails. The acceptance rate is at least about 0.3 in all cases.
+/// - The bounds may be infinite, e.g. `a = 0` and `b = std::numeric_limits<RealType>::infinity()`.
+template<std::floating_point RealType = double>
+class truncated_normal_distribution
+{
+    using method = detail::truncated_normal_distribution::method;
+
+  public:
+    using result_type = RealType;
+
+    /// The parameters of the distribution together with the data derived from them.
+    ///
+    /// # Notes
+    /// Sampling with a `param_type` passed to `operator()` uses it instead of the parameters of the distribution, so
+    /// switching between a set of truncations doesn't require choosing the proposal each time.
+    class param_type
+    {
+      public:
+        using distribution_type = truncated_normal_distribution;
+
+        /// Constructs the parameters of a truncated normal distribution
+        ///
+        /// # Preconditions
+        /// See the constructor of `truncated_normal_distribution`.
+        constexpr param_type(RealType mean, RealType stddev, RealType a, RealType b) noexcept
+            : m_mean(mean)
+            , m_stddev(stddev)
+            , m_a(a)
+            , m_b(b)
+            // Intervals entirely below the mean are mirrored, so that the standardized interval always has `beta > 0`
+            , m_sign(b <= mean ? -1 : 1)
+            , m_alpha(m_sign > 0 ? (a - mean) / stddev : (mean - b) / stddev)
+            , m_beta(m_sign > 0 ? (b - mean) / stddev : (mean - a) / stddev)
+            , m_method(detail::truncated_normal_distribution::select_method(m_alpha, m_beta))
+            , m_rate(m_method == method::exponential
+                         ? detail::truncated_normal_distribution::exponential_rate(m_alpha)
+                         : RealType{0})
+        {
+            assert(stddev > 0);
+            assert(a < b);
+        }
+
+        /// Returns the `mean` parameter.
+        [[nodiscard]] constexpr auto mean() const noexcept -> result_type { return m_mean; }
+        /// Returns the `stddev` parameter.
+        [[nodiscard]] constexpr auto stddev() const noexcept -> result_type { return m_stddev; }
+        /// Returns the `a` parameter.
+        [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_a; }
+        /// Returns the `b` parameter.
+        [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_b; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class truncated_normal_distribution;
+
+        result_type m_mean;
+        result_type m_stddev;
+        result_type m_a;
+        result_type m_b;
+        result_type m_sign;
+        result_type m_alpha;
+        result_type m_beta;
+        method      m_method;
+        result_type m_rate;
+    };
+
+    /// Constructs a truncated normal distribution
+    ///
+    /// # Parameters
+    /// - `mean`
+    ///     The mean value of the untruncated normal distribution
+    /// - `stddev`
+    ///     The standard deviation of the untruncated normal distribution
+    /// - `a`
+    ///     The lower bound of the generated values
+    /// - `b`
+    ///     The upper bound of the generated values
+    ///
+    /// # Preconditions
+    /// - Behavior is undefined if `stddev <= 0`.
+    /// - Behavior is undefined if `a >= b`.
+    constexpr truncated_normal_distribution(RealType mean, RealType stddev, RealType a, RealType b) noexcept
+        : m_param(mean, stddev, a, b)
+    {
+    }
+
+    /// Generates random numbers in [`a`, `b`] according to `mean` and `stddev`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Amortized constant number of invocations of `g()`, independent of the bounds.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) -> result_type
+    {
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random numbers according to the parameters `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Same as `operator()(g)`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) -> result_type
+    {
+        RealType z{};
+        switch (p.m_method)
+        {
+        case method::normal:
+            do
+                z = m_normal(g);
+            while (z < p.m_alpha || z > p.m_beta);
+            break;
+        case method::uniform:
+        {
+            // The density is largest at 0 if the interval contains it, and at `alpha` otherwise
+            auto const peak = p.m_alpha > 0 ? p.m_alpha * p.m_alpha : RealType{0};
+            do
+                z = p.m_alpha + (p.m_beta - p.m_alpha) * s_unit(g);
+            while (s_unit(g) > std::exp((peak - z * z) / 2));
+            break;
+        }
+        case method::exponential:
+            do
+                z = p.m_alpha - std::log(s_open_unit(g)) / p.m_rate;
+            while (z > p.m_beta || s_unit(g) > std::exp(-(z - p.m_rate) * (z - p.m_rate) / 2));
+            break;
+        }
+        return std::clamp(p.m_mean + p.m_sign * p.m_stddev * z, p.m_a, p.m_b);
+    }
+
+    /// Returns the `mean` parameter the distribution was constructed with.
+    constexpr auto mean() const noexcept -> result_type { return m_param.m_mean; }
+    /// Returns the `stddev` parameter the distribution was constructed with.
+    constexpr auto stddev() const noexcept -> result_type { return m_param.m_stddev; }
+    /// Returns the `a` parameter the distribution was constructed with.
+    constexpr auto a() const noexcept -> result_type { return m_param.m_a; }
+    /// Returns the `b` parameter the distribution was constructed with.
+    constexpr auto b() const noexcept -> result_type { return m_param.m_b; }
+
+    /// Returns the minimum potentially generated value
+    constexpr auto min() const noexcept -> result_type { return m_param.m_a; }
+    /// Returns the maximum potentially generated value
+    constexpr auto max() const noexcept -> result_type { return m_param.m_b; }
+
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(truncated_normal_distribution const& lhs,
+                                     truncated_normal_distribution const& rhs) noexcept -> bool = default;
+
+  private:
+    static constexpr uniform_real_distribution<result_type> s_unit{inclusive<result_type>{0.},
+                                                                   exclusive<result_type>{1.}};
+    static constexpr uniform_real_distribution<result_type> s_open_unit{exclusive<result_type>{0.},
+                                                                        inclusive<result_type>{1.}};
+
+    param_type                       m_param;
+    normal_distribution<result_type> m_normal;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_TRUNCATED_NORMAL_DISTRIBUTION_HPP
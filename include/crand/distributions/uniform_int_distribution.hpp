@@ -25,13 +25,20 @@
 #ifndef CONSTEXPR_RANDOM_UNIFORM_INT_DISTRIBUTION_HPP
 #define CONSTEXPR_RANDOM_UNIFORM_INT_DISTRIBUTION_HPP
 
+#include "crand/concepts/random_bit_source.hpp"
 #include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+#include "crand/distributions/detail/integer_traits.hpp"
 #include "crand/distributions/detail/uniform_int_distribution_details.hpp"
 #include "crand/distributions/distribution_limits.hpp"
+#include "crand/engines/generate.hpp"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <concepts>
 #include <limits>
+#include <span>
 
 #include <cassert>
 #include <climits>
@@ -45,12 +52,100 @@ namespace crand
 /// # Notes
 /// - `uniform_int_distribution` satisfies `random_number_distribution`.
 /// - As its `operator()` is `const`, creating `constexpr` variables of this type can make sense.
-template<std::integral IntType = int>
+template<detail::integer IntType = int>
 class uniform_int_distribution
 {
   public:
     using result_type = IntType;
 
+    /// The parameters of the distribution, i.e. its range together with the data derived from it.
+    ///
+    /// # Notes
+    /// Sampling with a `param_type` passed to `operator()` uses it instead of the parameters of the distribution, so
+    /// switching between a set of ranges doesn't require constructing a distribution each time.
+    class param_type
+    {
+      public:
+        using distribution_type = uniform_int_distribution;
+
+        /// Constructs the parameters of a distribution that generates numbers in [a, b]
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_int_distribution`.
+        constexpr param_type(inclusive<IntType> a, inclusive<IntType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_min(m_a)
+            , m_max(m_b)
+            , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        {
+            assert(m_a <= m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in (a, b]
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_int_distribution`.
+        constexpr param_type(exclusive<IntType> a, inclusive<IntType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_min(m_a + 1)
+            , m_max(m_b)
+            , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        {
+            assert(m_a < m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in [a, b)
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_int_distribution`.
+        constexpr param_type(inclusive<IntType> a, exclusive<IntType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_min(m_a)
+            , m_max(m_b - 1)
+            , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        {
+            assert(m_a < m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in (a, b)
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_int_distribution`.
+        constexpr param_type(exclusive<IntType> a, exclusive<IntType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_min(m_a + 1)
+            , m_max(m_b - 1)
+            , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        {
+            assert(m_b - m_a > 1);
+        }
+
+        /// Returns the `a` parameter.
+        [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_a; }
+        /// Returns the `b` parameter.
+        [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_b; }
+        /// Returns the minimum potentially generated value.
+        [[nodiscard]] constexpr auto min() const noexcept -> result_type { return m_min; }
+        /// Returns the maximum potentially generated value.
+        [[nodiscard]] constexpr auto max() const noexcept -> result_type { return m_max; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class uniform_int_distribution;
+
+        IntType      m_a;
+        IntType      m_b;
+        IntType      m_min;
+        IntType      m_max;
+        std::uint8_t m_range_bits;
+    };
+
     /// Constructs a distribution that generates numbers in [a, b]
     ///
     /// # Parameters
@@ -65,13 +160,8 @@ class uniform_int_distribution
     /// # Notes
     /// If `a == b`, the distribution will always produce the same value.
     constexpr uniform_int_distribution(inclusive<IntType> a, inclusive<IntType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_min(m_a)
-        , m_max(m_b)
-        , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        : m_param(a, b)
     {
-        assert(m_a <= m_b);
     }
 
     /// Constructs a distribution that generates numbers in (a, b]
@@ -85,13 +175,8 @@ class uniform_int_distribution
     /// # Preconditions
     /// Behavior is undefined if `a >= b`.
     constexpr uniform_int_distribution(exclusive<IntType> a, inclusive<IntType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_min(m_a + 1)
-        , m_max(m_b)
-        , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        : m_param(a, b)
     {
-        assert(m_a < m_b);
     }
 
     /// Constructs a distribution that generates numbers in [a, b)
@@ -105,13 +190,8 @@ class uniform_int_distribution
     /// # Preconditions
     /// Behavior is undefined if `a >= b`.
     constexpr uniform_int_distribution(inclusive<IntType> a, exclusive<IntType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_min(m_a)
-        , m_max(m_b - 1)
-        , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        : m_param(a, b)
     {
-        assert(m_a < m_b);
     }
 
     /// Constructs a distribution that generates numbers in (a, b)
@@ -125,13 +205,8 @@ class uniform_int_distribution
     /// # Preconditions
     /// Behavior is undefined if `a - b <= 1`.
     constexpr uniform_int_distribution(exclusive<IntType> a, exclusive<IntType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_min(m_a + 1)
-        , m_max(m_b - 1)
-        , m_range_bits(detail::uniform_int_distribution::range_bit_width(m_min, m_max))
+        : m_param(a, b)
     {
-        assert(m_b - m_a > 1);
     }
 
     /// Generates random integers in the desired range
@@ -144,39 +219,160 @@ class uniform_int_distribution
     ///     The generated random integer.
     ///
     /// # Complexity
-    ///     Amortized constant number of invocations of `g()`.
+    ///     Amortized constant number of invocations of `g()`: Each attempt takes `ceil(bits / w)` invocations, where
+    ///     `bits` is the bit width of the range and `w` the bit width of the words produced by `g`. If `g` satisfies
+    ///     `random_bit_source`, only as many bits as needed to cover the range are consumed per attempt.
     template<uniform_random_bit_generator G>
     constexpr auto operator()(G& g) const -> result_type
     {
-        using engine_int = std::invoke_result_t<G&>;
-        using uint_t     = std::make_unsigned_t<result_type>;
-        using result_t   = std::conditional_t<(sizeof(uint_t) > sizeof(engine_int)), uint_t, engine_int>;
-        result_t result;
-        do
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random integers in the range given by `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random integer.
+    ///
+    /// # Complexity
+    ///     Same as `operator()(g)`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) const -> result_type
+    {
+        using engine_int                  = std::invoke_result_t<G&>;
+        using uint_t                      = detail::make_unsigned_t<result_type>;
+        constexpr std::size_t engine_bits = sizeof(engine_int) * CHAR_BIT;
+
+        // Returns `n` random bits: the top bits of a word, or only as many bits as needed if `g` is a random bit source
+        auto const draw = [&g](std::size_t n) -> engine_int
+        {
+            if constexpr (random_bit_source<G>)
+                return g.bits(n);
+            else
+                return static_cast<engine_int>(g() >> (engine_bits - n));
+        };
+
+        // Samples ranges that fit into a single word. If the range is a power of two, the rejection branch is never
+        // taken.
+        auto const sample_word = [&]
         {
-            result        = 0;
-            std::size_t i = 0;
-            for (; i < m_range_bits; i += sizeof(engine_int) * CHAR_BIT)
+            auto const range = static_cast<engine_int>(static_cast<uint_t>(p.m_max) - static_cast<uint_t>(p.m_min));
+            engine_int result;
+            do
+                result = draw(p.m_range_bits);
+            while (result > range);
+            return static_cast<result_type>(static_cast<uint_t>(p.m_min) + static_cast<uint_t>(result));
+        };
+
+        if constexpr (sizeof(uint_t) <= sizeof(engine_int))
+            return sample_word();
+        else
+        {
+            if (p.m_range_bits <= engine_bits)
+                return sample_word();
+
+            // The range spans several words: The leading word contributes the bits that don't fill a whole word, all
+            // other words are appended in full.
+            auto const words        = (p.m_range_bits + engine_bits - 1) / engine_bits;
+            auto const leading_bits = p.m_range_bits - (words - 1) * engine_bits;
+            auto const range        = static_cast<uint_t>(static_cast<uint_t>(p.m_max) - static_cast<uint_t>(p.m_min));
+            uint_t     result;
+            do
             {
-                result <<= i;
-                result |= g();
+                result = draw(leading_bits);
+                for (std::size_t i = 1; i < words; ++i)
+                    result = static_cast<uint_t>(result << engine_bits) | g();
+            } while (result > range);
+            return static_cast<result_type>(static_cast<uint_t>(p.m_min) + result);
+        }
+    }
+
+    /// Fills `out` with random integers in the desired range
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// - Equivalent to assigning `(*this)(g)` to each element of `out` in order.
+    /// - If the range fits into a single word, words are drawn from `g` in bulk through `crand::generate`, never more
+    ///   than values remain to be produced.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        generate(g, out, m_param);
+    }
+
+    /// Fills `out` with random integers in the range given by `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g, p)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out, param_type const& p) const
+    {
+        using engine_int                  = std::invoke_result_t<G&>;
+        using uint_t                      = detail::make_unsigned_t<result_type>;
+        constexpr std::size_t engine_bits = sizeof(engine_int) * CHAR_BIT;
+
+        if (random_bit_source<G> || p.m_range_bits > engine_bits)
+        {
+            for (auto& x : out)
+                x = (*this)(g, p);
+            return;
+        }
+
+        // Each word yields at most one value, so requesting as many words as values remain never consumes more words
+        // than the scalar path would. This also means `out[i]` is always in range, so every candidate is written and
+        // only kept if it is accepted, which avoids a hard to predict branch.
+        auto const range = static_cast<engine_int>(static_cast<uint_t>(p.m_max) - static_cast<uint_t>(p.m_min));
+        auto const shift = engine_bits - p.m_range_bits;
+        std::array<engine_int, detail::generate_n::batch_size> words{};
+        std::size_t                                            i = 0;
+        while (i < out.size())
+        {
+            auto const chunk = std::span{words}.first(std::min(words.size(), out.size() - i));
+            crand::generate(g, chunk);
+            for (auto const w : chunk)
+            {
+                auto const r = static_cast<engine_int>(w >> shift);
+                out[i]       = static_cast<result_type>(static_cast<uint_t>(p.m_min) + static_cast<uint_t>(r));
+                i += r <= range ? 1 : 0;
             }
-            auto const shift = i - m_range_bits;
-            assert(shift < sizeof(result) * CHAR_BIT);
-            result >>= shift;
-        } while (result > (max() - min()));
-        return result + min();
+        }
     }
 
     /// Returns the `a` parameter the distribution was constructed with.
-    constexpr auto a() const noexcept -> result_type { return m_a; }
+    constexpr auto a() const noexcept -> result_type { return m_param.m_a; }
     /// Returns the `b` parameter the distribution was constructed with.
-    constexpr auto b() const noexcept -> result_type { return m_b; }
+    constexpr auto b() const noexcept -> result_type { return m_param.m_b; }
 
     /// Returns the minimum potentially generated value
-    constexpr auto min() const noexcept -> result_type { return m_min; };
+    constexpr auto min() const noexcept -> result_type { return m_param.m_min; };
     /// Returns the maximum potentially generated value
-    constexpr auto max() const noexcept -> result_type { return m_max; };
+    constexpr auto max() const noexcept -> result_type { return m_param.m_max; };
+
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
 
     /// Compares two distribution objects by their internal state.
     ///
@@ -186,11 +382,7 @@ class uniform_int_distribution
         -> bool = default;
 
   private:
-    IntType      m_a;
-    IntType      m_b;
-    IntType      m_min;
-    IntType      m_max;
-    std::uint8_t m_range_bits;
+    param_type m_param;
 };
 } // namespace crand
 
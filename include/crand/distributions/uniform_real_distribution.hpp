@@ -26,13 +26,22 @@
 #define CONSTEXPR_RANDOM_UNIFORM_REAL_DISTRIBUTION_HPP
 
 #include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
 #include "crand/distributions/detail/uniform_real_distribution_details.hpp"
 #include "crand/distributions/distribution_limits.hpp"
 #include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/generate.hpp"
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <concepts>
+#include <limits>
+#include <span>
+#include <type_traits>
 
 #include <cassert>
+#include <climits>
 #include <cmath>
 
 namespace crand
@@ -54,6 +63,213 @@ class uniform_real_distribution
   public:
     using result_type = RealType;
 
+    /// The parameters of the distribution, i.e. its range together with the data derived from it.
+    ///
+    /// # Notes
+    /// - Sampling with a `param_type` passed to `operator()` uses it instead of the parameters of the distribution, so
+    ///   switching between a set of ranges doesn't require constructing a distribution each time.
+    /// - `rebind` creates the parameters for other bounds, reusing the derived data if the bounds are merely shifted.
+    class param_type
+    {
+      public:
+        using distribution_type = uniform_real_distribution;
+
+        /// Constructs the parameters of a distribution that generates numbers in [a, b]
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_real_distribution`.
+        constexpr param_type(inclusive<RealType> a, inclusive<RealType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
+            , m_hi(m_g > 0 ? detail::uniform_real_distribution::ceilint(m_a, m_b, m_g) : 0)
+            , m_min(m_a)
+            , m_max(m_b)
+            , m_int_dist(inclusive{index_type{0}}, inclusive{static_cast<index_type>(m_hi)})
+            , m_gn(generator<inclusive, inclusive>(std::abs(m_a) <= std::abs(m_b)))
+        {
+            assert(m_b - m_a <= std::numeric_limits<RealType>::max());
+            assert(m_a <= m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in (a, b]
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_real_distribution`.
+        constexpr param_type(exclusive<RealType> a, inclusive<RealType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
+            , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
+            , m_min(std::abs(m_a) <= std::abs(m_b) ? m_b - (m_hi - 1) * m_g : m_a + m_g)
+            , m_max(m_b)
+            , m_int_dist(inclusive{index_type{0}}, inclusive{static_cast<index_type>(m_hi - 1)})
+            , m_gn(generator<exclusive, inclusive>(std::abs(m_a) <= std::abs(m_b)))
+        {
+            assert(m_b - m_a <= std::numeric_limits<RealType>::max());
+            assert(m_a < m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in [a, b)
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_real_distribution`.
+        constexpr param_type(inclusive<RealType> a, exclusive<RealType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
+            , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
+            , m_min(m_a)
+            , m_max(std::abs(m_a) <= std::abs(m_b) ? m_b - m_g : m_a + (m_hi - 1) * m_g)
+            , m_int_dist(inclusive{index_type{1}}, inclusive{static_cast<index_type>(m_hi)})
+            , m_gn(generator<inclusive, exclusive>(std::abs(m_a) <= std::abs(m_b)))
+        {
+            assert(m_b - m_a <= std::numeric_limits<RealType>::max());
+            assert(m_a < m_b);
+        }
+
+        /// Constructs the parameters of a distribution that generates numbers in (a, b)
+        ///
+        /// # Preconditions
+        /// See the corresponding constructor of `uniform_real_distribution`.
+        constexpr param_type(exclusive<RealType> a, exclusive<RealType> b) noexcept
+            : m_a(a.value)
+            , m_b(b.value)
+            , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
+            , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
+            , m_min(std::abs(m_a) <= std::abs(m_b) ? m_b - (m_hi - 1) * m_g : m_a + m_g)
+            , m_max(std::abs(m_a) <= std::abs(m_b) ? m_b - m_g : m_a + (m_hi - 1) * m_g)
+            , m_int_dist(inclusive{index_type{1}}, inclusive{static_cast<index_type>(m_hi - 1)})
+            , m_gn(generator<exclusive, exclusive>(std::abs(m_a) <= std::abs(m_b)))
+        {
+            assert(m_b - m_a <= std::numeric_limits<RealType>::max());
+            assert(m_a < m_b);
+//            assert(std::nexttoward(m_a, m_b) != m_b); // TODO: check why it doesn't compile
+        }
+
+        /// Returns the parameters of a distribution generating numbers between `a` and `b`
+        ///
+        /// # Parameters
+        /// - a
+        ///     The new lower bound
+        /// - b
+        ///     The new upper bound
+        ///
+        /// # Return Value
+        ///     Parameters equal to `param_type(a, b)`.
+        ///
+        /// # Complexity
+        ///     If the new bounds are the current ones shifted by a multiple of `gamma()`, without leaving the
+        ///     floating-point exponent range that determines `gamma()`, gamma, the number of values and the inner
+        ///     integer distribution are reused rather than recomputed.
+        template<template<typename> typename A, template<typename> typename B>
+        [[nodiscard]] constexpr auto rebind(A<RealType> a, B<RealType> b) const noexcept -> param_type
+        {
+            auto const t = a.value - m_a;
+            if (m_gn == generator<A, B>(std::abs(m_a) <= std::abs(m_b)) && is_shift(a.value, b.value, t))
+            {
+                param_type p = *this;
+                p.m_a        = a.value;
+                p.m_b        = b.value;
+                p.m_min += t;
+                p.m_max += t;
+                return p;
+            }
+            return param_type(a, b);
+        }
+
+        /// Returns the `a` parameter.
+        [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_a; }
+        /// Returns the `b` parameter.
+        [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_b; }
+        /// Returns the minimum potentially generated value.
+        [[nodiscard]] constexpr auto min() const noexcept -> result_type { return m_min; }
+        /// Returns the maximum potentially generated value.
+        [[nodiscard]] constexpr auto max() const noexcept -> result_type { return m_max; }
+        /// Returns the smallest difference two generated values may have.
+        [[nodiscard]] constexpr auto gamma() const noexcept -> result_type { return m_g; }
+
+        /// Compares two parameter objects.
+        friend constexpr auto operator==(param_type const&, param_type const&) noexcept -> bool = default;
+
+      private:
+        friend class uniform_real_distribution;
+
+        using index_type     = detail::uniform_real_distribution::index_type<RealType>;
+        using generator_type = RealType (*)(RealType a, RealType b, RealType g, RealType hi, index_type k);
+
+        // Selects the function mapping an integer to a value for the given kinds of bounds. `loe` tells whether `a`
+        // is less than or equal to `b` in magnitude.
+        template<template<typename> typename A, template<typename> typename B>
+        [[nodiscard]] static constexpr auto generator(bool loe) noexcept -> generator_type
+        {
+            namespace d = detail::uniform_real_distribution;
+            if constexpr (std::same_as<A<RealType>, inclusive<RealType>>
+                          && std::same_as<B<RealType>, inclusive<RealType>>)
+                return loe ? d::gen_inclusive_inclusive_loe<RealType> : d::gen_inclusive_inclusive_nloe<RealType>;
+            else if constexpr (std::same_as<A<RealType>, exclusive<RealType>>
+                               && std::same_as<B<RealType>, inclusive<RealType>>)
+                return loe ? d::gen_exclusive_inclusive_loe<RealType> : d::gen_exclusive_inclusive_nloe<RealType>;
+            else if constexpr (std::same_as<A<RealType>, inclusive<RealType>>
+                               && std::same_as<B<RealType>, exclusive<RealType>>)
+                return loe ? d::gen_inclusive_exclusive_loe<RealType> : d::gen_inclusive_exclusive_nloe<RealType>;
+            else
+                return loe ? d::gen_exclusive_exclusive_loe<RealType> : d::gen_exclusive_exclusive_nloe<RealType>;
+        }
+
+        // Maps the indices `ks` to values in `out`. The generator is resolved once and passed on as a compile-time
+        // constant, so that it can be inlined into the loop.
+        constexpr void map(std::span<index_type const> ks, std::span<RealType> out) const
+        {
+            namespace d = detail::uniform_real_distribution;
+
+            auto const loop = [&]<generator_type Gn>
+            {
+                if (m_gn != Gn)
+                    return false;
+                d::map([](auto... args) { return Gn(args...); }, m_a, m_b, m_g, static_cast<RealType>(m_hi), ks, out);
+                return true;
+            };
+            // clang-format off
+            (void)(loop.template operator()<d::gen_inclusive_inclusive_loe<RealType>>()
+                || loop.template operator()<d::gen_inclusive_inclusive_nloe<RealType>>()
+                || loop.template operator()<d::gen_exclusive_inclusive_loe<RealType>>()
+                || loop.template operator()<d::gen_exclusive_inclusive_nloe<RealType>>()
+                || loop.template operator()<d::gen_inclusive_exclusive_loe<RealType>>()
+                || loop.template operator()<d::gen_inclusive_exclusive_nloe<RealType>>()
+                || loop.template operator()<d::gen_exclusive_exclusive_loe<RealType>>()
+                || loop.template operator()<d::gen_exclusive_exclusive_nloe<RealType>>());
+            // clang-format on
+        }
+
+        // Tells whether [a, b] is [m_a, m_b] shifted by `t` such that gamma and the number of values stay the same.
+        // This is the case if the shift is exact, the number of values is exactly representable and the bound of larger
+        // magnitude keeps its side and stays in (l, 2l], the range of magnitudes whose next value towards zero is gamma
+        // away. Both bounds of larger magnitude are then multiples of gamma, and so is the shift between them.
+        [[nodiscard]] constexpr auto is_shift(RealType a, RealType b, RealType t) const noexcept -> bool
+        {
+            constexpr auto eps = std::numeric_limits<RealType>::epsilon();
+            if (!(m_g > 0 && static_cast<RealType>(m_hi) * eps < 1))
+                return false;
+
+            bool const loe = std::abs(a) <= std::abs(b);
+            auto const big = loe ? std::abs(b) : std::abs(a);
+            auto const l   = m_g / eps;
+            return loe == (std::abs(m_a) <= std::abs(m_b)) && l < big && big <= 2 * l
+                && detail::uniform_real_distribution::is_exact_sum(m_a, t, a)
+                && detail::uniform_real_distribution::is_exact_sum(m_b, t, b);
+        }
+
+        RealType                              m_a;
+        RealType                              m_b;
+        RealType                              m_g;
+        std::size_t                           m_hi;
+        RealType                              m_min;
+        RealType                              m_max;
+        uniform_int_distribution<index_type>  m_int_dist;
+        generator_type                        m_gn;
+    };
+
     /// Constructs a distribution that generates numbers in [a, b]
     ///
     /// # Parameters
@@ -69,19 +285,8 @@ class uniform_real_distribution
     /// # Notes
     /// If `a == b`, the distribution will always produce the same value.
     constexpr uniform_real_distribution(inclusive<RealType> a, inclusive<RealType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
-        , m_hi(m_g > 0 ? detail::uniform_real_distribution::ceilint(m_a, m_b, m_g) : 0)
-        , m_min(m_a)
-        , m_max(m_b)
-        , m_int_dist(inclusive{std::size_t{0}}, inclusive{m_hi})
-        , m_gn(std::abs(m_a) <= std::abs(m_b)
-                   ? detail::uniform_real_distribution::gen_inclusive_inclusive_loe<RealType>
-                   : detail::uniform_real_distribution::gen_inclusive_inclusive_nloe<RealType>)
+        : m_param(a, b)
     {
-        assert(m_b - m_a <= std::numeric_limits<RealType>::max());
-        assert(m_a <= m_b);
     }
 
     /// Constructs a distribution that generates numbers in (a, b]
@@ -100,19 +305,8 @@ class uniform_real_distribution
     /// Due to the way IEEE-754 floating point representation works, there may be values larger than `a` (but lower than
     /// `b`) that are never generated.
     constexpr uniform_real_distribution(exclusive<RealType> a, inclusive<RealType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
-        , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
-        , m_min(std::abs(m_a) <= std::abs(m_b) ? m_b - (m_hi - 1) * m_g : m_a + m_g)
-        , m_max(m_b)
-        , m_int_dist(inclusive{std::size_t{0}}, inclusive{m_hi - 1})
-        , m_gn(std::abs(m_a) <= std::abs(m_b)
-                   ? detail::uniform_real_distribution::gen_exclusive_inclusive_loe<RealType>
-                   : detail::uniform_real_distribution::gen_exclusive_inclusive_nloe<RealType>)
+        : m_param(a, b)
     {
-        assert(m_b - m_a <= std::numeric_limits<RealType>::max());
-        assert(m_a < m_b);
     }
 
     /// Constructs a distribution that generates numbers in [a, b)
@@ -131,19 +325,8 @@ class uniform_real_distribution
     /// Due to the way IEEE-754 floating point representation works, there may be values less than `b` (but greater than
     /// `a`) that are never generated.
     constexpr uniform_real_distribution(inclusive<RealType> a, exclusive<RealType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
-        , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
-        , m_min(m_a)
-        , m_max(std::abs(m_a) <= std::abs(m_b) ? m_b - m_g : m_a + (m_hi - 1) * m_g)
-        , m_int_dist(inclusive{std::size_t{1}}, inclusive{m_hi})
-        , m_gn(std::abs(m_a) <= std::abs(m_b)
-                   ? detail::uniform_real_distribution::gen_inclusive_exclusive_loe<RealType>
-                   : detail::uniform_real_distribution::gen_inclusive_exclusive_nloe<RealType>)
+        : m_param(a, b)
     {
-        assert(m_b - m_a <= std::numeric_limits<RealType>::max());
-        assert(m_a < m_b);
     }
 
     /// Constructs a distribution that generates numbers in (a, b)
@@ -164,20 +347,8 @@ class uniform_real_distribution
     /// `b`) that are never generated, and there may be values less than `b` (but greater than `a`) that are never
     /// generated.
     constexpr uniform_real_distribution(exclusive<RealType> a, exclusive<RealType> b) noexcept
-        : m_a(a.value)
-        , m_b(b.value)
-        , m_g(detail::uniform_real_distribution::compute_gamma(m_a, m_b))
-        , m_hi(detail::uniform_real_distribution::ceilint(m_a, m_b, m_g))
-        , m_min(std::abs(m_a) <= std::abs(m_b) ? m_b - (m_hi - 1) * m_g : m_a + m_g)
-        , m_max(std::abs(m_a) <= std::abs(m_b) ? m_b - m_g : m_a + (m_hi - 1) * m_g)
-        , m_int_dist(inclusive{std::size_t{1}}, inclusive{m_hi - 1})
-        , m_gn(std::abs(m_a) <= std::abs(m_b)
-                   ? detail::uniform_real_distribution::gen_exclusive_exclusive_loe<RealType>
-                   : detail::uniform_real_distribution::gen_exclusive_exclusive_nloe<RealType>)
+        : m_param(a, b)
     {
-        assert(m_b - m_a <= std::numeric_limits<RealType>::max());
-        assert(m_a < m_b);
-//        assert(std::nexttoward(m_a, m_b) != m_b); // TODO: check why it doesn't compile
     }
 
     /// Generates random numbers in the desired range
@@ -194,26 +365,180 @@ class uniform_real_distribution
     template<uniform_random_bit_generator G>
     constexpr auto operator()(G& g) const -> result_type
     {
-        auto const k = m_int_dist(g);
-        return m_gn(m_a, m_b, m_g, m_hi, k);
+        return (*this)(g, m_param);
+    }
+
+    /// Generates random numbers in the range given by `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Return Value
+    ///     The generated random number.
+    ///
+    /// # Complexity
+    ///     Amortized constant number of invocations of `g()`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g, param_type const& p) const -> result_type
+    {
+        auto const k = p.m_int_dist(g);
+        return p.m_gn(p.m_a, p.m_b, p.m_g, p.m_hi, k);
+    }
+
+    /// Fills `out` with random numbers in the desired range
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out) const
+    {
+        generate(g, out, m_param);
+    }
+
+    /// Fills `out` with random numbers in the range given by `p`
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Notes
+    /// Equivalent to assigning `(*this)(g, p)` to each element of `out` in order.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<result_type> out, param_type const& p) const
+    {
+        std::array<typename param_type::index_type, detail::generate_n::batch_size> ks{};
+        for (std::size_t i = 0; i < out.size(); i += ks.size())
+        {
+            auto const chunk = out.subspan(i, std::min(ks.size(), out.size() - i));
+            auto const k     = std::span{ks}.first(chunk.size());
+            p.m_int_dist.generate(g, k);
+            p.map(k, chunk);
+        }
+    }
+
+    /// Fills `out` with random numbers in the desired range, using every bit of the engine words
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`. With a 64-bit engine, each invocation
+    ///     yields up to two `float` values, or up to four values of a 16-bit floating-point type.
+    ///
+    /// # Notes
+    /// - Each engine word is split into lanes of 16, 32 or 64 bits, just wide enough to hold any grid index of
+    ///   `RealType`, and each lane, starting from the most significant one, stands in for a word of `operator()`.
+    ///   The values therefore lie on the same grid and follow the same distribution as those of `operator()`, but
+    ///   they are not the same sequence.
+    /// - Never draws more words than needed for the values remaining to be produced; lanes left over in the last word
+    ///   are discarded.
+    /// - For `double`, a lane is a whole word and the result equals that of `generate`.
+    template<uniform_random_bit_generator G>
+    constexpr void generate_packed(G& g, std::span<result_type> out) const
+    {
+        generate_packed(g, out, m_param);
+    }
+
+    /// Fills `out` with random numbers in the range given by `p`, using every bit of the engine words
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     The range to fill
+    /// - p
+    ///     The parameters to use instead of those of the distribution
+    ///
+    /// # Notes
+    /// See `generate_packed(g, out)`.
+    template<uniform_random_bit_generator G>
+    constexpr void generate_packed(G& g, std::span<result_type> out, param_type const& p) const
+    {
+        using index_type                  = typename param_type::index_type;
+        using engine_int                  = std::invoke_result_t<G&>;
+        constexpr std::size_t engine_bits = sizeof(engine_int) * CHAR_BIT;
+        constexpr std::size_t lane_bits
+            = std::min(engine_bits, detail::uniform_real_distribution::lane_bits<RealType>);
+        constexpr std::size_t lanes = engine_bits / lane_bits;
+        static_assert(G::min() == 0 && G::max() == std::numeric_limits<engine_int>::max(),
+                      "generate_packed requires an engine producing all bits of its result type");
+
+        // Indices wider than a word, such as those of `double` with a 32-bit engine, take several words each
+        auto const min        = p.m_int_dist.min();
+        auto const range_bits = std::max<std::size_t>(std::bit_width(p.m_int_dist.max() - min), 1);
+        if (range_bits > lane_bits)
+        {
+            generate(g, out, p);
+            return;
+        }
+        auto const range = static_cast<engine_int>(p.m_int_dist.max() - min);
+        auto const shift = engine_bits - range_bits;
+
+        // Every candidate is written and only kept if it is accepted, so the index buffer has room for the candidates
+        // of one more word than there are values left.
+        std::array<engine_int, detail::generate_n::batch_size>         words{};
+        std::array<index_type, detail::generate_n::batch_size + lanes> ks{};
+        for (std::size_t i = 0; i < out.size(); i += detail::generate_n::batch_size)
+        {
+            auto const  chunk = out.subspan(i, std::min(detail::generate_n::batch_size, out.size() - i));
+            std::size_t n     = 0;
+            while (n < chunk.size())
+            {
+                auto const w = std::span{words}.first((chunk.size() - n + lanes - 1) / lanes);
+                crand::generate(g, w);
+                for (auto const word : w)
+                    for (std::size_t l = 0; l < lanes; ++l)
+                    {
+                        auto const lane = static_cast<engine_int>(word << (l * lane_bits));
+                        auto const r    = static_cast<engine_int>(lane >> shift);
+                        ks[n]           = static_cast<index_type>(min + r);
+                        n += r <= range ? 1 : 0;
+                    }
+            }
+            p.map(std::span{ks}.first(chunk.size()), chunk);
+        }
     }
 
     /// Returns the `a` parameter the distribution was constructed with.
-    [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_a; }
+    [[nodiscard]] constexpr auto a() const noexcept -> result_type { return m_param.m_a; }
     /// Returns the `b` parameter the distribution was constructed with.
-    [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_b; }
+    [[nodiscard]] constexpr auto b() const noexcept -> result_type { return m_param.m_b; }
     /// Returns the minimum potentially generated value.
-    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return m_min; }
+    [[nodiscard]] constexpr auto min() const noexcept -> result_type { return m_param.m_min; }
     /// Returns the maximum potentially generated value.
-    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return m_max; }
+    [[nodiscard]] constexpr auto max() const noexcept -> result_type { return m_param.m_max; }
     /// Returns the smallest difference two generated values may have.
-    [[nodiscard]] constexpr auto gamma() const noexcept -> result_type { return m_g; }
+    [[nodiscard]] constexpr auto gamma() const noexcept -> result_type { return m_param.m_g; }
     /// Returns the amount of values that can be generated.
     [[nodiscard]] constexpr auto num_unique_values() const noexcept -> std::size_t
     {
-        return m_int_dist.max() - m_int_dist.min();
+        return m_param.m_int_dist.max() - m_param.m_int_dist.min();
     }
 
+    /// Returns the parameters of the distribution.
+    [[nodiscard]] constexpr auto param() const noexcept -> param_type const& { return m_param; }
+    /// Replaces the parameters of the distribution.
+    constexpr void param(param_type const& p) noexcept { m_param = p; }
+
     /// Compares two distribution objects by their internal state.
     ///
     /// # Notes
@@ -222,14 +547,7 @@ class uniform_real_distribution
                                      uniform_real_distribution const& rhs) noexcept -> bool = default;
 
   private:
-    RealType                              m_a;
-    RealType                              m_b;
-    RealType                              m_g;
-    std::size_t                           m_hi;
-    RealType                              m_min;
-    RealType                              m_max;
-    uniform_int_distribution<std::size_t> m_int_dist;
-    RealType (*m_gn)(RealType a, RealType b, RealType g, RealType hi, std::size_t k);
+    param_type m_param;
 };
 } // namespace crand
 
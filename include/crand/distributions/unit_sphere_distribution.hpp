@@ -0,0 +1,214 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_UNIT_SPHERE_DISTRIBUTION_HPP
+#define CONSTEXPR_RANDOM_UNIT_SPHERE_DISTRIBUTION_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/structure_of_arrays.hpp"
+#include "crand/distributions/detail/unit_sphere_distribution_details.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace crand
+{
+/// Produces points uniformly distributed on the surface of the unit sphere in `D` dimensions.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates, e.g. `3` for the ordinary sphere and `2` for the circle
+///
+/// # Notes
+/// - As its result type is an array, `unit_sphere_distribution` doesn't satisfy `random_number_distribution`, but
+///   otherwise provides the same interface.
+/// - For `D == 2` and `D == 3`, points are computed from a pair of uniform numbers in the unit disk (von Neumann's and
+///   Marsaglia's methods), which takes no logarithms and at most one square root. Otherwise, a vector of normal
+///   numbers is normalized.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0)
+class unit_sphere_distribution
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Generates a random point on the unit sphere
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    ///
+    /// # Return Value
+    ///     The generated random point.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `D`.
+    template<uniform_random_bit_generator G>
+    constexpr auto operator()(G& g) -> result_type
+    {
+        if constexpr (D == 2)
+        {
+            auto const [u, v, s] = disk_point(g);
+            return {(u * u - v * v) / s, 2 * u * v / s};
+        }
+        else if constexpr (D == 3)
+        {
+            auto const [u, v, s] = disk_point(g);
+            auto const f         = 2 * std::sqrt(1 - s);
+            return {u * f, v * f, 1 - 2 * s};
+        }
+        else
+        {
+            result_type point;
+            RealType    norm;
+            do
+            {
+                norm = 0;
+                for (auto& x : point)
+                {
+                    x = m_normal(g);
+                    norm += x * x;
+                }
+            } while (norm == 0);
+
+            auto const r = 1 / std::sqrt(norm);
+            for (auto& x : point)
+                x *= r;
+            return point;
+        }
+    }
+
+    /// Generates `out.size() / D` random points in structure-of-arrays layout
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator`
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     Amortized linear number of invocations of `g()` in `out.size()`.
+    ///
+    /// # Notes
+    /// For `D > 3`, the normal numbers are generated row by row through `normal_distribution::generate` and normalized
+    /// in blocks of columns, so the points differ from those of repeated invocations of `operator()`, but follow the
+    /// same distribution.
+    template<uniform_random_bit_generator G>
+    constexpr void generate(G& g, std::span<RealType> out)
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+
+        if constexpr (D == 2 || D == 3)
+        {
+            for (std::size_t j = 0; j < m; ++j)
+                detail::scatter((*this)(g), out, m, j);
+        }
+        else
+        {
+            constexpr auto block_columns = detail::unit_sphere_distribution::block_columns;
+
+            m_normal.generate(g, out);
+            std::array<RealType, block_columns> scale{};
+            for (std::size_t begin = 0; begin < m; begin += block_columns)
+            {
+                auto const columns = std::min(block_columns, m - begin);
+                auto const row     = [&](std::size_t i) { return out.subspan(i * m + begin, columns); };
+
+                std::fill_n(scale.begin(), columns, RealType{0});
+                for (std::size_t i = 0; i < D; ++i)
+                {
+                    auto const r = row(i);
+                    for (std::size_t j = 0; j < columns; ++j)
+                        scale[j] += r[j] * r[j];
+                }
+                for (std::size_t j = 0; j < columns; ++j)
+                    scale[j] = scale[j] > 0 ? 1 / std::sqrt(scale[j]) : RealType{0};
+                for (std::size_t i = 0; i < D; ++i)
+                {
+                    auto const r = row(i);
+                    for (std::size_t j = 0; j < columns; ++j)
+                        r[j] *= scale[j];
+                }
+
+                // Vectors of length zero can't be normalized, but practically never occur
+                for (std::size_t j = 0; j < columns; ++j)
+                    if (scale[j] == 0)
+                        detail::scatter((*this)(g), out, m, begin + j);
+            }
+        }
+    }
+
+    /// Compares two distribution objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(unit_sphere_distribution const& lhs, unit_sphere_distribution const& rhs) noexcept
+        -> bool = default;
+
+  private:
+    struct disk_sample
+    {
+        RealType u;
+        RealType v;
+        RealType s;
+    };
+
+    /// Returns a point (u, v) uniformly distributed in the unit disk without its center, and s = u^2 + v^2.
+    template<uniform_random_bit_generator G>
+    static constexpr auto disk_point(G& g) -> disk_sample
+    {
+        disk_sample p;
+        do
+        {
+            p.u = s_symmetric_unit(g);
+            p.v = s_symmetric_unit(g);
+            p.s = p.u * p.u + p.v * p.v;
+        } while (p.s >= 1 || p.s == 0);
+        return p;
+    }
+
+    static constexpr uniform_real_distribution<RealType> s_symmetric_unit{exclusive<RealType>{-1.},
+                                                                          exclusive<RealType>{1.}};
+
+    normal_distribution<RealType> m_normal;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_UNIT_SPHERE_DISTRIBUTION_HPP
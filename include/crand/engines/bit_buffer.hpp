@@ -0,0 +1,140 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_BIT_BUFFER_HPP
+#define CONSTEXPR_RANDOM_BIT_BUFFER_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+
+#include <concepts>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <cassert>
+#include <climits>
+#include <cstddef>
+
+namespace crand
+{
+/// Engine adapter handing out random bits in chunks of arbitrary size.
+///
+/// Each word produced by the underlying engine is consumed from its most significant bit downwards. A request for
+/// more bits than are left in the buffered word discards the remainder and draws a new word.
+///
+/// # Notes
+/// - `bit_buffer` satisfies `random_bit_source`. Distributions given a `bit_buffer` only consume the bits they need,
+///   e.g. a `uniform_int_distribution` over 4 values draws one engine word every 32 samples instead of every sample.
+/// - `operator()` returns a fresh word from the underlying engine and leaves the buffered bits untouched.
+/// - The underlying engine must produce every value of its result type, i.e. `G::min()` must be `0` and `G::max()`
+///   the maximum of its result type.
+template<uniform_random_bit_generator G>
+class bit_buffer
+{
+  public:
+    using result_type = std::invoke_result_t<G&>;
+
+    static_assert(G::min() == 0 && G::max() == std::numeric_limits<result_type>::max(),
+                  "bit_buffer requires an engine producing all bits of its result type");
+
+    /// The number of bits in one word of the underlying engine.
+    static constexpr std::size_t word_bits = sizeof(result_type) * CHAR_BIT;
+
+    /// Constructs the adapter with a default-constructed engine.
+    constexpr bit_buffer() noexcept(std::is_nothrow_default_constructible_v<G>) = default;
+
+    /// Constructs the adapter
+    ///
+    /// # Parameters
+    /// - engine
+    ///     The engine to draw words from
+    constexpr explicit bit_buffer(G engine) noexcept(std::is_nothrow_move_constructible_v<G>)
+        : m_engine(std::move(engine))
+    {
+    }
+
+    /// Returns a fresh word from the underlying engine.
+    constexpr auto operator()() -> result_type { return m_engine(); }
+
+    /// Returns `n` random bits.
+    ///
+    /// # Parameters
+    /// - n
+    ///     The number of bits; in [`1`, `word_bits`]
+    ///
+    /// # Return Value
+    /// A random number in [`0`, `2^n`).
+    ///
+    /// # Complexity
+    /// At most one invocation of the underlying engine.
+    constexpr auto bits(std::size_t n) -> result_type
+    {
+        assert(n > 0 && n <= word_bits);
+        if (m_available < n)
+        {
+            m_word      = m_engine();
+            m_available = word_bits;
+        }
+        auto const result = static_cast<result_type>(m_word >> (word_bits - n));
+        m_word            = static_cast<result_type>(static_cast<result_type>(m_word << (n - 1)) << 1u);
+        m_available -= n;
+        return result;
+    }
+
+    /// Returns `N` random bits.
+    ///
+    /// # Return Value
+    /// A random number in [`0`, `2^N`).
+    ///
+    /// # Complexity
+    /// At most one invocation of the underlying engine.
+    template<std::size_t N>
+        requires(N > 0 && N <= word_bits)
+    constexpr auto bits() -> result_type
+    {
+        return bits(N);
+    }
+
+    /// Returns the underlying engine.
+    [[nodiscard]] constexpr auto base() const noexcept -> G const& { return m_engine; }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return G::min(); }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return G::max(); }
+
+    /// Compares two adapters by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(bit_buffer const& lhs, bit_buffer const& rhs) -> bool = default;
+
+  private:
+    G           m_engine{};
+    result_type m_word      = 0;
+    std::size_t m_available = 0;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_BIT_BUFFER_HPP
@@ -0,0 +1,174 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_BUFFERED_ENGINE_HPP
+#define CONSTEXPR_RANDOM_BUFFERED_ENGINE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "generate.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+
+namespace crand
+{
+/// Engine adapter that generates values in blocks and serves them one at a time.
+///
+/// Whenever the buffer is exhausted, it is refilled through `crand::generate`, which uses the bulk path of the
+/// underlying engine if there is one (e.g. the parallel block computation of `chacha_engine`). `operator()` then only
+/// needs to load the next value from the buffer, which keeps call sites small and moves the work of the engine into a
+/// tight loop.
+///
+/// # Parameters
+/// - G
+///     The underlying engine
+/// - N
+///     The number of values buffered at once
+///
+/// # Notes
+/// - The sequence of values is the same as the one produced by the underlying engine, both at runtime and in
+///   constant evaluation.
+/// - The state of `base()` is ahead of the values returned so far by up to `N` values.
+template<uniform_random_bit_generator G, std::size_t N = 128>
+class buffered_engine
+{
+    static_assert(N > 0, "buffer must hold at least one value");
+
+  public:
+    using result_type = std::invoke_result_t<G&>;
+
+    /// Constructs the adapter with a default-constructed engine.
+    constexpr buffered_engine() noexcept(std::is_nothrow_default_constructible_v<G>) = default;
+
+    /// Constructs the adapter
+    ///
+    /// # Parameters
+    /// - engine
+    ///     The engine to draw values from
+    constexpr explicit buffered_engine(G engine) noexcept(std::is_nothrow_move_constructible_v<G>)
+        : m_engine(std::move(engine))
+    {
+    }
+
+    /// Re-seeds the underlying engine and discards all buffered values.
+    ///
+    /// # Parameters
+    /// - args
+    ///     Forwarded to `G::seed()`
+    template<typename... Args>
+        requires requires(G& g, Args&&... args) { g.seed(std::forward<Args>(args)...); }
+    constexpr void seed(Args&&... args)
+    {
+        m_engine.seed(std::forward<Args>(args)...);
+        m_index = N;
+    }
+
+    /// Returns the next value.
+    ///
+    /// # Complexity
+    /// Amortized constant; the buffer is refilled every `N` calls.
+    constexpr auto operator()() -> result_type
+    {
+        if (m_index == N)
+            refill();
+        return m_buffer[m_index++];
+    }
+
+    /// Fills `out` with consecutive values.
+    ///
+    /// # Notes
+    /// Functionally equivalent to assigning the result of `operator()` to each element of `out`. After the buffered
+    /// values are used up, the underlying engine writes directly into `out`.
+    constexpr void generate(std::span<result_type> out)
+    {
+        auto const n = std::min(out.size(), N - m_index);
+        std::copy_n(m_buffer.begin() + m_index, n, out.begin());
+        m_index += n;
+        crand::generate(m_engine, out.subspan(n));
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Complexity
+    /// The complexity of `G::discard`, if available, otherwise linear in `z`.
+    constexpr void discard(unsigned long long z)
+    {
+        auto const buffered = static_cast<unsigned long long>(N - m_index);
+        if (z <= buffered)
+        {
+            m_index += z;
+            return;
+        }
+        z -= buffered;
+        m_index = N;
+        if constexpr (requires { m_engine.discard(z); })
+            m_engine.discard(z);
+        else
+            for (; z > 0; --z)
+                m_engine();
+    }
+
+    /// Returns the underlying engine.
+    [[nodiscard]] constexpr auto base() const noexcept -> G const& { return m_engine; }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return G::min(); }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return G::max(); }
+
+    /// Compares two adapters by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(buffered_engine const& lhs, buffered_engine const& rhs) -> bool
+    {
+        return lhs.m_engine == rhs.m_engine && lhs.m_index == rhs.m_index
+               && std::equal(lhs.m_buffer.begin() + lhs.m_index,
+                             lhs.m_buffer.end(),
+                             rhs.m_buffer.begin() + rhs.m_index);
+    }
+
+  private:
+    constexpr void refill()
+    {
+        // Working on a local copy tells the compiler that writing the buffer can't modify the engine state, so the
+        // state stays in registers during the loop
+        G engine = m_engine;
+        crand::generate(engine, std::span{m_buffer});
+        m_engine = engine;
+        m_index  = 0;
+    }
+
+    G                                      m_engine{};
+    alignas(64) std::array<result_type, N> m_buffer{};
+    std::size_t                            m_index = N;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_BUFFERED_ENGINE_HPP
@@ -0,0 +1,318 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_CHACHA_ENGINE_HPP
+#define CONSTEXPR_RANDOM_CHACHA_ENGINE_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "detail/chacha_engine_details.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Random number engine based on the ChaCha stream cipher.
+///
+/// The key stream of ChaCha with a 64 bit block counter and 64 bit nonce (the stream) is returned word by word.
+/// Several blocks are generated at once and buffered; at runtime these are computed in parallel.
+///
+/// # Notes
+/// - The `chacha8`, `chacha12` and `chacha20` typedefs define the engine with common round counts.
+/// - While the output is the ChaCha key stream, this engine makes no attempt to protect its state (e.g. against
+///   side channels or memory disclosure). Don't use it for cryptographic purposes.
+template<std::size_t Rounds>
+class chacha_engine
+{
+    static_assert(Rounds > 0 && Rounds % 2 == 0, "Rounds must be a positive, even number");
+
+  public:
+    using result_type = std::uint32_t;
+    using key_type    = detail::chacha_engine::key_type;
+
+    static constexpr std::uint64_t default_seed = 1;
+
+    /// Constructs the engine with a default seed
+    constexpr chacha_engine() noexcept
+        : chacha_engine(default_seed)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - value
+    ///     Value used to seed the engine; it is expanded into a key
+    /// - stream
+    ///     Selects the output sequence (the ChaCha nonce)
+    constexpr explicit chacha_engine(std::uint64_t value, std::uint64_t stream = 0) noexcept
+        : chacha_engine(detail::chacha_engine::seed(value), stream)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - key
+    ///     The 256 bit ChaCha key
+    /// - stream
+    ///     Selects the output sequence (the ChaCha nonce)
+    constexpr explicit chacha_engine(key_type const& key, std::uint64_t stream = 0) noexcept
+        : m_key(key)
+        , m_stream(stream)
+        , m_counter(0)
+        , m_buffer{}
+        , m_index(0)
+    {
+        refill();
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize both the key and the stream
+    template<seed_sequence S>
+    constexpr explicit chacha_engine(S&& seq)
+        : m_key()
+        , m_stream(0)
+        , m_counter(0)
+        , m_buffer{}
+        , m_index(0)
+    {
+        this->seed(seq);
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(std::uint64_t value = default_seed, std::uint64_t stream = 0) noexcept
+    {
+        seed(detail::chacha_engine::seed(value), stream);
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(key_type const& key, std::uint64_t stream = 0) noexcept
+    {
+        m_key     = key;
+        m_stream  = stream;
+        m_counter = 0;
+        m_index   = 0;
+        refill();
+    }
+
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        auto const [key, stream] = detail::chacha_engine::seed_from(seq);
+        seed(key, stream);
+    }
+
+    /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
+    /// function will return the next number in the sequence).
+    ///
+    /// # Return Value
+    /// A pseudo-random number in [`min`, `max`].
+    ///
+    /// # Complexity
+    /// Amortized constant.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        if (m_index == m_buffer.size())
+            next_buffer();
+        return m_buffer[m_index++];
+    }
+
+    /// Fills `out` with consecutive pseudo-random values.
+    ///
+    /// # Parameters
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    /// Linear in `out.size()`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to assigning the result of `operator()` to each element of `out`, but copies whole
+    /// blocks at once. Once the buffered blocks are used up, blocks are computed directly into `out`.
+    constexpr void generate(std::span<result_type> out) noexcept
+    {
+        constexpr std::size_t buffer_words = detail::chacha_engine::buffer_words;
+        while (!out.empty())
+        {
+            if (m_index == m_buffer.size() && out.size() >= buffer_words)
+            {
+                // The internal buffer stays exhausted; it is only refilled if required by the next call
+                m_counter += detail::chacha_engine::parallel_blocks;
+                detail::chacha_engine::generate_blocks<Rounds>(m_key, m_counter, m_stream, out.first<buffer_words>());
+                out = out.subspan(buffer_words);
+                continue;
+            }
+            if (m_index == m_buffer.size())
+                next_buffer();
+            auto const n = std::min(out.size(), m_buffer.size() - m_index);
+            std::copy_n(m_buffer.begin() + m_index, n, out.begin());
+            m_index += n;
+            out = out.subspan(n);
+        }
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Parameters
+    /// - z
+    ///     The number of times to advance the internal state
+    ///
+    /// # Complexity
+    /// Constant.
+    ///
+    /// # Notes
+    /// Functionally equivalent to calling `operator()` `z` times, but constant instead of linear.
+    constexpr void discard(unsigned long long z) noexcept
+    {
+        if (skip(z))
+            refill();
+    }
+
+    /// Returns the stream the engine was seeded with.
+    [[nodiscard]] constexpr auto stream() const noexcept -> std::uint64_t { return m_stream; }
+
+    /// The complete engine state, as returned by `state()`: key, stream, block counter and position in the buffer.
+    using state_array = std::array<std::uint32_t, 13>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array
+    {
+        return {m_key[0],
+                m_key[1],
+                m_key[2],
+                m_key[3],
+                m_key[4],
+                m_key[5],
+                m_key[6],
+                m_key[7],
+                static_cast<std::uint32_t>(m_stream),
+                static_cast<std::uint32_t>(m_stream >> 32u),
+                static_cast<std::uint32_t>(m_counter),
+                static_cast<std::uint32_t>(m_counter >> 32u),
+                static_cast<std::uint32_t>(m_index)};
+    }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    ///
+    /// # Complexity
+    /// Constant; the buffered blocks are recomputed.
+    ///
+    /// # Notes
+    /// A position beyond the buffered blocks, which `state()` never returns, is folded into the block counter, as if
+    /// the engine had been advanced that far by `discard`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> chacha_engine
+    {
+        chacha_engine e{chacha_engine::uninitialized_tag{}};
+        std::copy_n(state.begin(), e.m_key.size(), e.m_key.begin());
+        e.m_stream  = state[8] | (std::uint64_t{state[9]} << 32u);
+        e.m_counter = state[10] | (std::uint64_t{state[11]} << 32u);
+        e.m_index   = 0;
+        e.skip(state[12]);
+        e.refill();
+        return e;
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return -1; }
+
+    /// Compares two engine objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(chacha_engine const& lhs, chacha_engine const& rhs) noexcept -> bool
+    {
+        return lhs.m_key == rhs.m_key && lhs.m_stream == rhs.m_stream && lhs.m_counter == rhs.m_counter
+               && lhs.m_index == rhs.m_index;
+    }
+
+  private:
+    struct uninitialized_tag
+    {
+    };
+    constexpr explicit chacha_engine(uninitialized_tag /*unused*/) noexcept
+        : m_key()
+        , m_stream(0)
+        , m_counter(0)
+        , m_buffer{}
+        , m_index(0)
+    {
+    }
+
+    constexpr void next_buffer() noexcept
+    {
+        m_counter += detail::chacha_engine::parallel_blocks;
+        m_index = 0;
+        refill();
+    }
+    constexpr void refill() noexcept
+    {
+        detail::chacha_engine::generate_blocks<Rounds>(m_key, m_counter, m_stream, m_buffer);
+    }
+    // Moves the position `z` values ahead without recomputing the buffer and returns whether that is required. Like
+    // `operator()`, a position at the end of a buffer stays there instead of moving to the start of the next one.
+    constexpr auto skip(unsigned long long z) noexcept -> bool
+    {
+        // Split `z` first, so that adding the current position cannot overflow
+        auto const position = m_index + z % m_buffer.size();
+        auto       buffers  = z / m_buffer.size() + position / m_buffer.size();
+        m_index             = position % m_buffer.size();
+        if (m_index == 0 && buffers > 0)
+        {
+            --buffers;
+            m_index = m_buffer.size();
+        }
+        m_counter += buffers * detail::chacha_engine::parallel_blocks;
+        return buffers > 0;
+    }
+
+    key_type                                                       m_key;
+    std::uint64_t                                                  m_stream;
+    std::uint64_t                                                  m_counter;
+    std::array<std::uint32_t, detail::chacha_engine::buffer_words> m_buffer;
+    std::size_t                                                    m_index;
+};
+
+/// Defines the ChaCha engine with 8 rounds.
+using chacha8 = chacha_engine<8>;
+/// Defines the ChaCha engine with 12 rounds.
+using chacha12 = chacha_engine<12>;
+/// Defines the ChaCha engine with 20 rounds, as in "ChaCha, a variant of Salsa20" by Bernstein, 2008.
+using chacha20 = chacha_engine<20>;
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_CHACHA_ENGINE_HPP
@@ -0,0 +1,215 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_CHACHA_ENGINE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_CHACHA_ENGINE_DETAILS_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "seed_from_sequence.hpp"
+#include "tiny_splitmix64.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::chacha_engine
+{
+inline constexpr std::size_t words_per_block = 16;
+inline constexpr std::size_t parallel_blocks = 4;
+inline constexpr std::size_t buffer_words    = words_per_block * parallel_blocks;
+
+using key_type = std::array<std::uint32_t, 8>;
+
+#if defined(__GNUC__)
+/// A group of `parallel_blocks` words that are processed in lock-step, one word per block.
+using lanes = std::uint32_t __attribute__((vector_size(parallel_blocks * sizeof(std::uint32_t))));
+#else
+/// A group of `parallel_blocks` words that are processed in lock-step, one word per block. Written as plain loops so
+/// that the compiler can map it onto vector registers.
+struct lanes
+{
+    std::array<std::uint32_t, parallel_blocks> v;
+
+    constexpr auto operator[](std::size_t i) noexcept -> std::uint32_t& { return v[i]; }
+    constexpr auto operator[](std::size_t i) const noexcept -> std::uint32_t { return v[i]; }
+
+    constexpr auto operator+=(lanes const& rhs) noexcept -> lanes&
+    {
+        for (std::size_t i = 0; i < parallel_blocks; ++i)
+            v[i] += rhs.v[i];
+        return *this;
+    }
+    constexpr auto operator^=(lanes const& rhs) noexcept -> lanes&
+    {
+        for (std::size_t i = 0; i < parallel_blocks; ++i)
+            v[i] ^= rhs.v[i];
+        return *this;
+    }
+    friend constexpr auto operator<<(lanes x, int s) noexcept -> lanes
+    {
+        for (auto& e : x.v)
+            e <<= s;
+        return x;
+    }
+    friend constexpr auto operator>>(lanes x, int s) noexcept -> lanes
+    {
+        for (auto& e : x.v)
+            e >>= s;
+        return x;
+    }
+    friend constexpr auto operator|(lanes x, lanes const& y) noexcept -> lanes
+    {
+        for (std::size_t i = 0; i < parallel_blocks; ++i)
+            x.v[i] |= y.v[i];
+        return x;
+    }
+};
+#endif
+
+/// Rotates every 32 bit word in `x` left by `s`, where `0 < s < 32`.
+template<typename W>
+constexpr auto rotl(W x, int s) noexcept -> W
+{
+    return (x << s) | (x >> (32 - s));
+}
+
+template<typename W>
+constexpr void quarter_round(std::array<W, words_per_block>& x, int a, int b, int c, int d) noexcept
+{
+    x[a] += x[b];
+    x[d] ^= x[a];
+    x[d] = rotl(x[d], 16);
+    x[c] += x[d];
+    x[b] ^= x[c];
+    x[b] = rotl(x[b], 12);
+    x[a] += x[b];
+    x[d] ^= x[a];
+    x[d] = rotl(x[d], 8);
+    x[c] += x[d];
+    x[b] ^= x[c];
+    x[b] = rotl(x[b], 7);
+}
+
+/// Applies the ChaCha core to `input`, where `W` is either a single word or a group of `lanes`.
+template<std::size_t Rounds, typename W>
+constexpr auto core(std::array<W, words_per_block> const& input) noexcept -> std::array<W, words_per_block>
+{
+    auto x = input;
+    for (std::size_t i = 0; i < Rounds; i += 2)
+    {
+        quarter_round(x, 0, 4, 8, 12);
+        quarter_round(x, 1, 5, 9, 13);
+        quarter_round(x, 2, 6, 10, 14);
+        quarter_round(x, 3, 7, 11, 15);
+        quarter_round(x, 0, 5, 10, 15);
+        quarter_round(x, 1, 6, 11, 12);
+        quarter_round(x, 2, 7, 8, 13);
+        quarter_round(x, 3, 4, 9, 14);
+    }
+    for (std::size_t i = 0; i < words_per_block; ++i)
+        x[i] += input[i];
+    return x;
+}
+
+constexpr auto input_block(key_type const& key, std::uint64_t counter, std::uint64_t nonce) noexcept
+    -> std::array<std::uint32_t, words_per_block>
+{
+    return {0x61707865,
+            0x3320646e,
+            0x79622d32,
+            0x6b206574,
+            key[0],
+            key[1],
+            key[2],
+            key[3],
+            key[4],
+            key[5],
+            key[6],
+            key[7],
+            static_cast<std::uint32_t>(counter),
+            static_cast<std::uint32_t>(counter >> 32u),
+            static_cast<std::uint32_t>(nonce),
+            static_cast<std::uint32_t>(nonce >> 32u)};
+}
+
+/// Writes `parallel_blocks` consecutive key stream blocks, starting at block `counter`, into `out`.
+template<std::size_t Rounds>
+constexpr void generate_blocks(key_type const&                        key,
+                               std::uint64_t                          counter,
+                               std::uint64_t                          nonce,
+                               std::span<std::uint32_t, buffer_words> out) noexcept
+{
+    if consteval
+    {
+        for (std::size_t b = 0; b < parallel_blocks; ++b)
+        {
+            auto const block = core<Rounds>(input_block(key, counter + b, nonce));
+            for (std::size_t w = 0; w < words_per_block; ++w)
+                out[b * words_per_block + w] = block[w];
+        }
+    }
+    else
+    {
+        std::array<lanes, words_per_block> input{};
+        for (std::size_t b = 0; b < parallel_blocks; ++b)
+        {
+            auto const block = input_block(key, counter + b, nonce);
+            for (std::size_t w = 0; w < words_per_block; ++w)
+                input[w][b] = block[w];
+        }
+        auto const x = core<Rounds>(input);
+        for (std::size_t b = 0; b < parallel_blocks; ++b)
+            for (std::size_t w = 0; w < words_per_block; ++w)
+                out[b * words_per_block + w] = x[w][b];
+    }
+}
+
+constexpr auto seed(std::uint64_t s) noexcept -> key_type
+{
+    key_type key{};
+    for (std::size_t i = 0; i < key.size(); i += 2)
+    {
+        auto const r = tiny_splitmix64(&s);
+        key[i]       = static_cast<std::uint32_t>(r);
+        key[i + 1]   = static_cast<std::uint32_t>(r >> 32u);
+    }
+    return key;
+}
+
+/// Retrieves the key and the stream from a seed sequence.
+template<seed_sequence S>
+constexpr auto seed_from(S& seq) -> std::pair<key_type, std::uint64_t>
+{
+    auto const words = seed_from_sequence<std::uint32_t, 10>(seq);
+    key_type   key{};
+    std::copy_n(words.begin(), key.size(), key.begin());
+    return {key, words[8] | (std::uint64_t{words[9]} << 32u)};
+}
+} // namespace crand::detail::chacha_engine
+
+#endif // CONSTEXPR_RANDOM_CHACHA_ENGINE_DETAILS_HPP
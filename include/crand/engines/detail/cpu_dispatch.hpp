@@ -0,0 +1,133 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_CPU_DISPATCH_HPP
+#define CONSTEXPR_RANDOM_CPU_DISPATCH_HPP
+
+#include <type_traits>
+
+#include <cstddef>
+
+namespace crand::detail::cpu_dispatch
+{
+/// Instruction set extensions a kernel may be compiled for, in increasing order of preference.
+enum class isa
+{
+    portable,
+    avx2,
+    avx512,
+};
+
+/// Width of the vector registers of an instruction set in bytes. The portable width is that of SSE2 and of most other
+/// architectures' vector extensions.
+template<isa Target>
+inline constexpr std::size_t vector_bytes = Target == isa::avx512 ? 64 : Target == isa::avx2 ? 32 : 16;
+
+/// Number of elements kernels process per block. A constant trip count lets the compiler vectorize a block without
+/// emitting a scalar epilogue for it.
+inline constexpr std::size_t block_size = 16;
+
+// Kernels are compiled for the extended instruction sets through function attributes. Floating-point kernels must give
+// the same results as the scalar code, so this relies on GCC, whose `optimize` attribute keeps multiplications and
+// additions from being fused in them. If the baseline target has FMA, the scalar code itself may have been fused, and
+// there is no way to match it.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && !defined(__FMA__)                              \
+    && !defined(CONSTEXPR_RANDOM_NO_CPU_DISPATCH)
+/// Determines the best instruction set supported by the executing CPU and operating system.
+[[nodiscard]] inline auto detect() noexcept -> isa
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+        return isa::avx512;
+    if (__builtin_cpu_supports("avx2"))
+        return isa::avx2;
+    return isa::portable;
+}
+
+template<typename F>
+[[gnu::target("avx2"), gnu::optimize("fp-contract=off"), gnu::flatten]]
+void run_avx2(F const& f)
+{
+    f(std::integral_constant<isa, isa::avx2>{});
+}
+template<typename F>
+[[gnu::target("avx512f,avx512dq,avx512vl,avx2"), gnu::optimize("fp-contract=off"), gnu::flatten]]
+void run_avx512(F const& f)
+{
+    f(std::integral_constant<isa, isa::avx512>{});
+}
+#else
+/// Determines the best instruction set supported by the executing CPU and operating system.
+[[nodiscard]] inline auto detect() noexcept -> isa
+{
+    return isa::portable;
+}
+
+// Never called, since `detect()` only reports the portable instruction set
+template<typename F>
+void run_avx2(F const& f)
+{
+    f(std::integral_constant<isa, isa::portable>{});
+}
+template<typename F>
+void run_avx512(F const& f)
+{
+    f(std::integral_constant<isa, isa::portable>{});
+}
+#endif
+
+/// The instruction set kernels are run for. Resolved once during static initialization; code running before that sees
+/// `isa::portable`.
+///
+/// # Notes
+/// May be lowered, e.g. to compare kernels, but never raised above `detect()`. Changing it is not thread-safe.
+inline isa selected = detect();
+
+/// Calls `f` with the selected instruction set as `std::integral_constant<isa, ...>`, compiled for that instruction
+/// set.
+///
+/// # Notes
+/// - Only the code inlined into `f` is compiled for the instruction set, so kernels should be written as templates in
+///   headers. All calls `f` makes are inlined where possible, since the compiler would otherwise leave larger kernels
+///   out of line, compiled for the baseline target.
+/// - Not usable in constant evaluation; callers pick the portable kernel there through `if consteval`.
+template<typename F>
+void invoke(F const& f)
+{
+    switch (selected)
+    {
+    case isa::avx512:
+        run_avx512(f);
+        return;
+    case isa::avx2:
+        run_avx2(f);
+        return;
+    case isa::portable:
+        break;
+    }
+    f(std::integral_constant<isa, isa::portable>{});
+}
+} // namespace crand::detail::cpu_dispatch
+
+#endif // CONSTEXPR_RANDOM_CPU_DISPATCH_HPP
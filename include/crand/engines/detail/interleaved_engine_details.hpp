@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_DETAILS_HPP
+
+#include "cpu_dispatch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include <cstddef>
+#include <cstring>
+
+namespace crand::detail::interleaved_engine
+{
+/// The state of `N` streams of an engine whose state consists of `S` words. Word `j` of all streams is stored
+/// contiguously, so that it can be loaded into a vector register at once.
+template<typename T, std::size_t S, std::size_t N>
+using state_type = std::array<std::array<T, N>, S>;
+
+/// Derives `N` streams from `g`: by splitting it, by jumping ahead or else by seeding engines from its output.
+template<std::size_t N, typename G>
+constexpr auto derive_streams(G& g) -> std::array<G, N>
+{
+    std::array<G, N> streams{};
+    for (auto& stream : streams)
+    {
+        if constexpr (requires { g.split(); })
+            stream = g.split();
+        else if constexpr (requires { g.discard_2_to_the_128(); })
+        {
+            stream = g;
+            g.discard_2_to_the_128();
+        }
+        else
+            stream = G{g()};
+    }
+    return streams;
+}
+
+/// Advances all streams once per `N` elements of `out`, writing the values of each round in stream order. Each stream
+/// is advanced on its own.
+template<typename G, typename T, std::size_t S, std::size_t N>
+constexpr void scalar_rounds(state_type<T, S, N>& state, std::span<T> out) noexcept
+{
+    for (std::size_t i = 0; i < out.size(); i += N)
+        for (std::size_t n = 0; n < N; ++n)
+        {
+            std::array<T, S> s{};
+            for (std::size_t j = 0; j < S; ++j)
+                s[j] = state[j][n];
+            G::advance(s, out[i + n]);
+            for (std::size_t j = 0; j < S; ++j)
+                state[j][n] = s[j];
+        }
+}
+
+#if defined(__GNUC__)
+/// A group of `W` words that are processed in lock-step, one word per stream. The attribute only applies to the
+/// dependent type through a member typedef.
+template<typename T, std::size_t W>
+struct lanes
+{
+    typedef T type __attribute__((vector_size(W * sizeof(T))));
+};
+
+/// Like `scalar_rounds`, but advances the streams in groups as wide as the vector registers of `Target`.
+template<cpu_dispatch::isa Target, typename G, typename T, std::size_t S, std::size_t N>
+void vector_rounds(state_type<T, S, N>& state, std::span<T> out) noexcept
+{
+    constexpr std::size_t width  = std::min(N, cpu_dispatch::vector_bytes<Target> / sizeof(T));
+    constexpr std::size_t groups = N / width;
+    using vector_type            = typename lanes<T, width>::type;
+    using group_type             = std::array<vector_type, S>;
+
+    std::array<group_type, groups> s;
+    for (std::size_t g = 0; g < groups; ++g)
+        for (std::size_t j = 0; j < S; ++j)
+            std::memcpy(&s[g][j], state[j].data() + g * width, sizeof(s[g][j]));
+    for (std::size_t i = 0; i < out.size(); i += N)
+        for (std::size_t g = 0; g < groups; ++g)
+        {
+            vector_type x;
+            G::advance(s[g], x);
+            std::memcpy(out.data() + i + g * width, &x, sizeof(x));
+        }
+    for (std::size_t g = 0; g < groups; ++g)
+        for (std::size_t j = 0; j < S; ++j)
+            std::memcpy(state[j].data() + g * width, &s[g][j], sizeof(s[g][j]));
+}
+#else
+/// Without vector extensions, the streams are advanced one after the other.
+template<cpu_dispatch::isa Target, typename G, typename T, std::size_t S, std::size_t N>
+void vector_rounds(state_type<T, S, N>& state, std::span<T> out) noexcept
+{
+    scalar_rounds<G>(state, out);
+}
+#endif
+} // namespace crand::detail::interleaved_engine
+
+#endif // CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_DETAILS_HPP
@@ -0,0 +1,53 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_LITTLE_ENDIAN_HPP
+#define CONSTEXPR_RANDOM_LITTLE_ENDIAN_HPP
+
+#include <concepts>
+
+#include <cstddef>
+
+namespace crand::detail
+{
+/// Reads an unsigned integer stored in little-endian byte order starting at `bytes`.
+template<std::unsigned_integral T>
+constexpr auto load_le(std::byte const* bytes) noexcept -> T
+{
+    T value = 0;
+    for (std::size_t b = 0; b < sizeof(T); ++b)
+        value |= static_cast<T>(static_cast<T>(bytes[b]) << (8u * b));
+    return value;
+}
+
+/// Stores an unsigned integer in little-endian byte order starting at `bytes`.
+template<std::unsigned_integral T>
+constexpr void store_le(std::byte* bytes, T value) noexcept
+{
+    for (std::size_t b = 0; b < sizeof(T); ++b)
+        bytes[b] = static_cast<std::byte>(value >> (8u * b));
+}
+} // namespace crand::detail
+
+#endif // CONSTEXPR_RANDOM_LITTLE_ENDIAN_HPP
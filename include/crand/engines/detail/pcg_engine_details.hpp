@@ -0,0 +1,121 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_PCG_ENGINE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_PCG_ENGINE_DETAILS_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "seed_from_sequence.hpp"
+#include "uint128.hpp"
+
+#include <array>
+#include <bit>
+#include <concepts>
+
+#include <cstdint>
+
+namespace crand::detail::pcg_engine
+{
+/// 64 bit LCG state, 32 bit output, "xorshift high, random rotation" permutation.
+struct xsh_rr_64_32
+{
+    using state_type  = std::uint64_t;
+    using result_type = std::uint32_t;
+
+    static constexpr state_type multiplier = 6364136223846793005u;
+
+    static constexpr auto output(state_type state) noexcept -> result_type
+    {
+        auto const xorshifted = static_cast<std::uint32_t>(((state >> 18u) ^ state) >> 27u);
+        auto const rot        = static_cast<int>(state >> 59u);
+        return std::rotr(xorshifted, rot);
+    }
+};
+
+/// 128 bit LCG state with 64 bit multiplier, 64 bit output, "double xorshift multiply" permutation.
+struct dxsm_128_64
+{
+    using state_type  = uint128;
+    using result_type = std::uint64_t;
+
+    static constexpr std::uint64_t cheap_multiplier = 0xda942042e4dd58b5;
+    static constexpr state_type    multiplier       = cheap_multiplier;
+
+    static constexpr auto output(state_type state) noexcept -> result_type
+    {
+        std::uint64_t       hi = state.hi;
+        std::uint64_t const lo = state.lo | 1u;
+        hi ^= hi >> 32u;
+        hi *= cheap_multiplier;
+        hi ^= hi >> 48u;
+        hi *= lo;
+        return hi;
+    }
+};
+
+template<typename StateType>
+constexpr auto step(StateType state, StateType multiplier, StateType increment) noexcept -> StateType
+{
+    return state * multiplier + increment;
+}
+
+/// Computes the state after `delta` steps in O(log(delta)) by exponentiation of the affine map `x -> m*x + c`
+/// (Brown, "Random Number Generation with Arbitrary Stride", 1994).
+template<typename StateType>
+constexpr auto advance(StateType state, unsigned long long delta, StateType multiplier, StateType increment) noexcept
+    -> StateType
+{
+    StateType acc_mult = 1u;
+    StateType acc_plus = 0u;
+    StateType cur_mult = multiplier;
+    StateType cur_plus = increment;
+    while (delta > 0)
+    {
+        if (delta & 1u)
+        {
+            acc_mult = acc_mult * cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1u) * cur_plus;
+        cur_mult = cur_mult * cur_mult;
+        delta >>= 1u;
+    }
+    return acc_mult * state + acc_plus;
+}
+
+/// Retrieves the initial state and the stream from a seed sequence.
+template<typename StateType, seed_sequence S>
+constexpr auto seed_from(S& seq) -> std::array<StateType, 2>
+{
+    if constexpr (std::same_as<StateType, uint128>)
+    {
+        auto const w = seed_from_sequence<std::uint64_t, 4>(seq);
+        return {uint128{w[0], w[1]}, uint128{w[2], w[3]}};
+    }
+    else
+        return seed_from_sequence<StateType, 2>(seq);
+}
+} // namespace crand::detail::pcg_engine
+
+#endif // CONSTEXPR_RANDOM_PCG_ENGINE_DETAILS_HPP
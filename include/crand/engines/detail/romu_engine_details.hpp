@@ -0,0 +1,57 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_ROMU_ENGINE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_ROMU_ENGINE_DETAILS_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "seed_from_sequence.hpp"
+#include "tiny_splitmix64.hpp"
+
+#include <array>
+
+#include <cstdint>
+
+namespace crand::detail::romu_engine
+{
+inline constexpr std::uint64_t multiplier = 15241094284759029579u;
+
+template<std::size_t N>
+constexpr auto seed(std::uint64_t s) noexcept -> std::array<std::uint64_t, N>
+{
+    std::array<std::uint64_t, N> state{};
+    for (auto& e : state)
+        e = tiny_splitmix64(&s);
+    return state;
+}
+
+template<std::size_t N, seed_sequence S>
+constexpr auto seed_from(S& seq) -> std::array<std::uint64_t, N>
+{
+    auto const state = seed_from_sequence<std::uint64_t, N>(seq);
+    return state != std::array<std::uint64_t, N>{} ? state : seed<N>(1);
+}
+} // namespace crand::detail::romu_engine
+
+#endif // CONSTEXPR_RANDOM_ROMU_ENGINE_DETAILS_HPP
@@ -0,0 +1,59 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SEED_FROM_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_SEED_FROM_SEQUENCE_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+
+#include <array>
+#include <concepts>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail
+{
+/// Retrieves enough 32 bit values from `seq` to fill `N` values of type `T`.
+template<std::unsigned_integral T, std::size_t N, seed_sequence S>
+constexpr auto seed_from_sequence(S& seq) -> std::array<T, N>
+{
+    constexpr std::size_t words_per_value = (sizeof(T) + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t);
+
+    std::array<std::uint32_t, N * words_per_value> words{};
+    seq.generate(words.data(), words.data() + words.size());
+
+    std::array<T, N> result{};
+    for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t w = 0; w < words_per_value; ++w)
+            if constexpr (words_per_value > 1)
+                result[i] |= static_cast<T>(words[i * words_per_value + w]) << (w * 32);
+            else
+                result[i] = static_cast<T>(words[i * words_per_value + w]);
+    return result;
+}
+} // namespace crand::detail
+
+#endif // CONSTEXPR_RANDOM_SEED_FROM_SEQUENCE_HPP
@@ -0,0 +1,103 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SEED_SEQ_DETAILS_HPP
+#define CONSTEXPR_RANDOM_SEED_SEQ_DETAILS_HPP
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::seed_seq
+{
+// Constants from seed_seq_fe in "randutils" by O'Neill, 2015.
+inline constexpr std::uint32_t init_a     = 0x43b0d7e5;
+inline constexpr std::uint32_t mult_a     = 0x931e8875;
+inline constexpr std::uint32_t init_b     = 0x8b51f9dd;
+inline constexpr std::uint32_t mult_b     = 0x58f38ded;
+inline constexpr std::uint32_t mix_mult_l = 0xca01f9dd;
+inline constexpr std::uint32_t mix_mult_r = 0x4973f715;
+inline constexpr unsigned      xshift     = 16;
+inline constexpr std::size_t   pool_size  = 8;
+
+constexpr auto mix(std::uint32_t x, std::uint32_t y) noexcept -> std::uint32_t
+{
+    std::uint32_t result = mix_mult_l * x - mix_mult_r * y;
+    return result ^ (result >> xshift);
+}
+
+/// Absorbs seed material word by word into a fixed size pool, such that every input bit affects every pool bit.
+struct entropy_pool
+{
+    std::array<std::uint32_t, pool_size> pool{};
+    std::uint32_t                        hash_const = init_a;
+    std::uint64_t                        count      = 0;
+
+    constexpr auto hash(std::uint32_t value) noexcept -> std::uint32_t
+    {
+        value ^= hash_const;
+        hash_const *= mult_a;
+        value *= hash_const;
+        return value ^ (value >> xshift);
+    }
+
+    constexpr void absorb(std::uint32_t word) noexcept
+    {
+        if (count < pool_size)
+        {
+            pool[count] = hash(word);
+            if (count == pool_size - 1)
+                for (std::size_t src = 0; src < pool_size; ++src)
+                    for (std::size_t dest = 0; dest < pool_size; ++dest)
+                        if (src != dest)
+                            pool[dest] = mix(pool[dest], hash(pool[src]));
+        }
+        else
+        {
+            auto const h = hash(word);
+            for (auto& dest : pool)
+                dest = mix(dest, h);
+        }
+        ++count;
+    }
+
+    constexpr void absorb64(std::uint64_t value) noexcept
+    {
+        absorb(static_cast<std::uint32_t>(value));
+        absorb(static_cast<std::uint32_t>(value >> 32u));
+    }
+
+    /// Absorbs the amount of input words (so that e.g. `{}` and `{0}` differ), and fills up the pool if necessary.
+    constexpr auto finish() noexcept -> std::array<std::uint32_t, pool_size>
+    {
+        absorb64(count);
+        while (count < pool_size)
+            absorb(0);
+        return pool;
+    }
+};
+} // namespace crand::detail::seed_seq
+
+#endif // CONSTEXPR_RANDOM_SEED_SEQ_DETAILS_HPP
@@ -0,0 +1,66 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STREAM_FILE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_STREAM_FILE_DETAILS_HPP
+
+#include "little_endian.hpp"
+
+#include <array>
+#include <string_view>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::stream_file
+{
+/// Identifies a stream file; the first eight bytes of every file.
+inline constexpr std::string_view magic = "CRANDSTR";
+
+/// Version of the file format written by this library.
+inline constexpr std::uint32_t version = 1;
+
+/// Size of the encoded header. The values follow immediately, so this also determines their alignment.
+inline constexpr std::size_t header_size = 128;
+
+/// Maximum length of the engine identifier.
+inline constexpr std::size_t engine_id_size = 32;
+
+/// Byte offsets of the header fields.
+inline constexpr std::size_t version_offset             = 8;
+inline constexpr std::size_t word_bytes_offset          = 12;
+inline constexpr std::size_t state_bytes_offset         = 16;
+inline constexpr std::size_t seed_offset                = 24;
+inline constexpr std::size_t count_offset               = 32;
+inline constexpr std::size_t checkpoint_interval_offset = 40;
+inline constexpr std::size_t engine_id_offset           = 64;
+
+/// Rounds `value` up to the next multiple of eight.
+constexpr auto align8(std::uint64_t value) noexcept -> std::uint64_t
+{
+    return (value + 7u) & ~std::uint64_t{7u};
+}
+} // namespace crand::detail::stream_file
+
+#endif // CONSTEXPR_RANDOM_STREAM_FILE_DETAILS_HPP
@@ -0,0 +1,142 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_UINT128_HPP
+#define CONSTEXPR_RANDOM_UINT128_HPP
+
+#include <compare>
+
+#include <cstdint>
+
+namespace crand::detail
+{
+/// Minimal unsigned 128 bit integer supporting the operations required by the engines.
+///
+/// # Notes
+/// `unsigned __int128` isn't available on all compilers, and even where it is, it doesn't satisfy
+/// `std::unsigned_integral` in strict ISO mode. This type is usable in constant expressions everywhere.
+struct uint128
+{
+    std::uint64_t hi;
+    std::uint64_t lo;
+
+    constexpr uint128() noexcept
+        : hi(0)
+        , lo(0)
+    {
+    }
+    constexpr uint128(std::uint64_t value) noexcept
+        : hi(0)
+        , lo(value)
+    {
+    }
+    constexpr uint128(std::uint64_t high, std::uint64_t low) noexcept
+        : hi(high)
+        , lo(low)
+    {
+    }
+
+    constexpr explicit operator std::uint64_t() const noexcept { return lo; }
+
+    friend constexpr auto operator+(uint128 lhs, uint128 rhs) noexcept -> uint128
+    {
+        std::uint64_t const lo = lhs.lo + rhs.lo;
+        return {lhs.hi + rhs.hi + (lo < lhs.lo), lo};
+    }
+    friend constexpr auto operator-(uint128 lhs, uint128 rhs) noexcept -> uint128
+    {
+        return {lhs.hi - rhs.hi - (lhs.lo < rhs.lo), lhs.lo - rhs.lo};
+    }
+    friend constexpr auto operator*(uint128 lhs, uint128 rhs) noexcept -> uint128;
+    friend constexpr auto operator<<(uint128 lhs, unsigned shift) noexcept -> uint128
+    {
+        if (shift == 0)
+            return lhs;
+        if (shift >= 64)
+            return {lhs.lo << (shift - 64), 0};
+        return {(lhs.hi << shift) | (lhs.lo >> (64 - shift)), lhs.lo << shift};
+    }
+    friend constexpr auto operator>>(uint128 lhs, unsigned shift) noexcept -> uint128
+    {
+        if (shift == 0)
+            return lhs;
+        if (shift >= 64)
+            return {0, lhs.hi >> (shift - 64)};
+        return {lhs.hi >> shift, (lhs.lo >> shift) | (lhs.hi << (64 - shift))};
+    }
+    friend constexpr auto operator&(uint128 lhs, uint128 rhs) noexcept -> uint128
+    {
+        return {lhs.hi & rhs.hi, lhs.lo & rhs.lo};
+    }
+    friend constexpr auto operator|(uint128 lhs, uint128 rhs) noexcept -> uint128
+    {
+        return {lhs.hi | rhs.hi, lhs.lo | rhs.lo};
+    }
+    friend constexpr auto operator^(uint128 lhs, uint128 rhs) noexcept -> uint128
+    {
+        return {lhs.hi ^ rhs.hi, lhs.lo ^ rhs.lo};
+    }
+
+    constexpr auto operator+=(uint128 rhs) noexcept -> uint128& { return *this = *this + rhs; }
+    constexpr auto operator*=(uint128 rhs) noexcept -> uint128& { return *this = *this * rhs; }
+    constexpr auto operator>>=(unsigned shift) noexcept -> uint128& { return *this = *this >> shift; }
+    constexpr auto operator<<=(unsigned shift) noexcept -> uint128& { return *this = *this << shift; }
+
+    friend constexpr auto operator==(uint128 const& lhs, uint128 const& rhs) noexcept -> bool = default;
+    friend constexpr auto operator<=>(uint128 const& lhs, uint128 const& rhs) noexcept
+        -> std::strong_ordering = default;
+};
+
+/// Computes the full 128 bit product of two 64 bit numbers.
+constexpr auto mul_64x64_128(std::uint64_t a, std::uint64_t b) noexcept -> uint128
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ using native_uint128 = unsigned __int128;
+    native_uint128 const r             = native_uint128{a} * b;
+    return {static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r)};
+#else
+    std::uint64_t const a_lo = a & 0xffffffff;
+    std::uint64_t const a_hi = a >> 32;
+    std::uint64_t const b_lo = b & 0xffffffff;
+    std::uint64_t const b_hi = b >> 32;
+
+    std::uint64_t const ll = a_lo * b_lo;
+    std::uint64_t const lh = a_lo * b_hi;
+    std::uint64_t const hl = a_hi * b_lo;
+    std::uint64_t const hh = a_hi * b_hi;
+
+    std::uint64_t const mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+    return {hh + (lh >> 32) + (hl >> 32) + (mid >> 32), (mid << 32) | (ll & 0xffffffff)};
+#endif
+}
+
+constexpr auto operator*(uint128 lhs, uint128 rhs) noexcept -> uint128
+{
+    uint128 r = mul_64x64_128(lhs.lo, rhs.lo);
+    r.hi += lhs.hi * rhs.lo + lhs.lo * rhs.hi;
+    return r;
+}
+} // namespace crand::detail
+
+#endif // CONSTEXPR_RANDOM_UINT128_HPP
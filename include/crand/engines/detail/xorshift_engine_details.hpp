@@ -25,6 +25,8 @@
 #ifndef CONSTEXPR_RANDOM_XORSHIFT_ENGINE_DETAILS_HPP
 #define CONSTEXPR_RANDOM_XORSHIFT_ENGINE_DETAILS_HPP
 
+#include "crand/concepts/seed_sequence.hpp"
+#include "seed_from_sequence.hpp"
 #include "tiny_splitmix64.hpp"
 
 namespace crand::detail::xorshift_engine
@@ -35,6 +37,12 @@ constexpr auto seed(T s) noexcept -> T
     std::uint64_t state = s;
     return tiny_splitmix64(&state);
 }
+template<typename T, seed_sequence S>
+constexpr auto seed_from(S& seq) -> T
+{
+    auto const [state] = seed_from_sequence<T, 1>(seq);
+    return state != 0 ? state : seed<T>(1);
+}
 } // namespace crand::detail::xorshift_engine
 
 #endif // CONSTEXPR_RANDOM_XORSHIFT_ENGINE_DETAILS_HPP
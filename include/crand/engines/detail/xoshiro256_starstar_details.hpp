@@ -25,6 +25,8 @@
 #ifndef CONSTEXPR_RANDOM_XOSHIRO256_STARSTAR_DETAILS_HPP
 #define CONSTEXPR_RANDOM_XOSHIRO256_STARSTAR_DETAILS_HPP
 
+#include "crand/concepts/seed_sequence.hpp"
+#include "seed_from_sequence.hpp"
 #include "tiny_splitmix64.hpp"
 
 #include <algorithm>
@@ -38,15 +40,26 @@ constexpr auto seed(std::uint64_t s) noexcept -> std::array<std::uint64_t, 4>
 {
     return {tiny_splitmix64(&s), tiny_splitmix64(&s), tiny_splitmix64(&s), tiny_splitmix64(&s)};
 }
+template<seed_sequence S>
+constexpr auto seed_from(S& seq) -> std::array<std::uint64_t, 4>
+{
+    auto const state = seed_from_sequence<std::uint64_t, 4>(seq);
+    return state != std::array<std::uint64_t, 4>{} ? state : seed(1);
+}
 
-constexpr auto advance_state(std::array<std::uint64_t, 4>& state) noexcept -> std::uint64_t
+// `V` is `std::uint64_t` or a vector of them, one per independent stream. Vectors are only passed by reference, since
+// passing them by value would depend on the instruction set.
+template<typename V>
+constexpr void advance_state(std::array<V, 4>& state, V& out) noexcept
 {
-    constexpr auto rol64 = [](std::uint64_t x, int k)
+    constexpr auto rol64 = [](V& x, int k)
     {
-        return (x << k) | (x >> (64 - k));
+        x = (x << k) | (x >> (64 - k));
     };
-    std::uint64_t const result = rol64(state[1] * 5, 7) * 9;
-    std::uint64_t const t      = state[1] << 17;
+    out = state[1] * 5;
+    rol64(out, 7);
+    out *= 9;
+    V const t = state[1] << 17;
 
     state[2] ^= state[0];
     state[3] ^= state[1];
@@ -54,8 +67,12 @@ constexpr auto advance_state(std::array<std::uint64_t, 4>& state) noexcept -> st
     state[0] ^= state[3];
 
     state[2] ^= t;
-    state[3] = rol64(state[3], 45);
-
+    rol64(state[3], 45);
+}
+constexpr auto advance_state(std::array<std::uint64_t, 4>& state) noexcept -> std::uint64_t
+{
+    std::uint64_t result{};
+    advance_state(state, result);
     return result;
 }
 template<std::array<std::uint64_t, 4> JumpTable>
@@ -0,0 +1,61 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_GENERATE_HPP
+#define CONSTEXPR_RANDOM_GENERATE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+
+#include <concepts>
+#include <span>
+
+namespace crand
+{
+/// Fills `out` with consecutive values generated by `g`.
+///
+/// # Parameters
+/// - g
+///     An object satisfying `uniform_random_bit_generator`
+/// - out
+///     The range to fill
+///
+/// # Complexity
+/// Linear in `out.size()`.
+///
+/// # Notes
+/// - Equivalent to assigning `g()` to each element of `out` in order, i.e. the engine state afterwards is the same as
+///   after `out.size()` invocations of `g()`.
+/// - If `g` provides a member function `generate(std::span<result_type>)`, that bulk path is used instead.
+template<uniform_random_bit_generator G>
+constexpr void generate(G& g, std::span<std::invoke_result_t<G&>> out)
+{
+    if constexpr (requires { g.generate(out); })
+        g.generate(out);
+    else
+        for (auto& x : out)
+            x = g();
+}
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_GENERATE_HPP
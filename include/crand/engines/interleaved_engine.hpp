@@ -0,0 +1,188 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_HPP
+#define CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_HPP
+
+#include "crand/concepts/serializable_engine.hpp"
+#include "detail/cpu_dispatch.hpp"
+#include "detail/interleaved_engine_details.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <span>
+#include <tuple>
+
+#include <cstddef>
+
+namespace crand
+{
+/// Engine adapter that runs `N` independent streams of an engine side by side and interleaves their values.
+///
+/// The `i`-th value belongs to stream `i % N`. The states of the streams are stored word by word, so that at runtime,
+/// as many streams as fit into a vector register are advanced by one instruction sequence; each stream only needs
+/// `1/N`-th of the values. Supported are engines that can advance a state of vectors through a static member function
+/// `advance`, i.e. `xorshift_engine`, `splitmix64_engine` and `xoshiro256_starstar`.
+///
+/// # Parameters
+/// - G
+///     The engine of each stream
+/// - N
+///     The number of streams; a power of two. Defaults to as many as fill 64 bytes.
+///
+/// # Notes
+/// - The streams derived from a single engine are: the engines split off it, if it supports `split()`, or else the
+///   engine jumped ahead by multiples of 2^128, if it supports `discard_2_to_the_128()`, or else engines seeded with
+///   its values. Note that seeded streams of `xorshift_engine` may overlap.
+/// - The sequence of values is the same at runtime and in constant evaluation, and independent of the instruction set
+///   of the CPU.
+template<serializable_engine G, std::size_t N = 64 / sizeof(typename G::result_type)>
+    requires requires(typename G::state_array& s, typename G::result_type& x) { G::advance(s, x); }
+class interleaved_engine
+{
+    static_assert(std::has_single_bit(N), "the number of streams must be a power of two");
+
+    using word_type = typename G::state_array::value_type;
+    static_assert(std::same_as<word_type, typename G::result_type>, "state words must be of the result type");
+
+    static constexpr std::size_t state_words = std::tuple_size_v<typename G::state_array>;
+
+  public:
+    using result_type = typename G::result_type;
+
+    /// Constructs the adapter with streams derived from a default-constructed engine.
+    constexpr interleaved_engine() noexcept
+        : interleaved_engine(G{})
+    {
+    }
+
+    /// Constructs the adapter
+    ///
+    /// # Parameters
+    /// - g
+    ///     The engine to derive the streams from
+    constexpr explicit interleaved_engine(G g) noexcept
+        : interleaved_engine(detail::interleaved_engine::derive_streams<N>(g))
+    {
+    }
+
+    /// Constructs the adapter
+    ///
+    /// # Parameters
+    /// - streams
+    ///     The engines whose values are interleaved
+    constexpr explicit interleaved_engine(std::array<G, N> const& streams) noexcept
+    {
+        for (std::size_t n = 0; n < N; ++n)
+        {
+            auto const s = streams[n].state();
+            for (std::size_t j = 0; j < state_words; ++j)
+                m_state[j][n] = s[j];
+        }
+    }
+
+    /// Returns the next value.
+    ///
+    /// # Complexity
+    /// Amortized constant; all streams are advanced every `N` calls.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        if (m_index == N)
+        {
+            rounds(m_buffer);
+            m_index = 0;
+        }
+        return m_buffer[m_index++];
+    }
+
+    /// Fills `out` with consecutive values.
+    ///
+    /// # Parameters
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    /// Linear in `out.size()`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to assigning the result of `operator()` to each element of `out`. After the buffered
+    /// values are used up, whole rounds of values are written directly into `out`.
+    constexpr void generate(std::span<result_type> out) noexcept
+    {
+        auto const n = std::min(out.size(), N - m_index);
+        std::copy_n(m_buffer.begin() + m_index, n, out.begin());
+        m_index += n;
+        out = out.subspan(n);
+
+        auto const whole = out.size() - out.size() % N;
+        rounds(out.first(whole));
+        out = out.subspan(whole);
+        if (!out.empty())
+        {
+            rounds(m_buffer);
+            std::copy_n(m_buffer.begin(), out.size(), out.begin());
+            m_index = out.size();
+        }
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return G::min(); }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return G::max(); }
+
+    /// Compares two engine objects by their streams and the buffered values not yet returned.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(interleaved_engine const& lhs, interleaved_engine const& rhs) -> bool
+    {
+        auto const remaining = [](interleaved_engine const& e) { return std::span{e.m_buffer}.subspan(e.m_index); };
+        return lhs.m_state == rhs.m_state && std::ranges::equal(remaining(lhs), remaining(rhs));
+    }
+
+  private:
+    // Advances every stream once per `N` elements of `out`
+    constexpr void rounds(std::span<result_type> out) noexcept
+    {
+        namespace d = detail::interleaved_engine;
+        if consteval
+        {
+            d::scalar_rounds<G>(m_state, out);
+        }
+        else
+        {
+            detail::cpu_dispatch::invoke([&](auto target)
+                                         { d::vector_rounds<decltype(target)::value, G>(m_state, out); });
+        }
+    }
+
+    detail::interleaved_engine::state_type<word_type, state_words, N> m_state{};
+    std::array<result_type, N>                                         m_buffer{};
+    std::size_t                                                        m_index = N;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_INTERLEAVED_ENGINE_HPP
@@ -0,0 +1,196 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_PCG_ENGINE_HPP
+#define CONSTEXPR_RANDOM_PCG_ENGINE_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "detail/pcg_engine_details.hpp"
+
+#include <array>
+#include <concepts>
+
+#include <cstdint>
+
+namespace crand
+{
+/// Random number engine based on the PCG family of algorithms.
+///
+/// The state is advanced by a linear congruential generator, and the output is obtained by applying a permutation
+/// function to the previous state. Every odd increment selects a different stream, i.e. a different sequence.
+///
+/// # Notes
+/// - The `pcg32` and `pcg64` typedefs define the engine with common parameter sets.
+/// - Seeding is identical to the reference implementation, so the same `seed` and `stream` produce the same output.
+template<typename Variant>
+class pcg_engine
+{
+  public:
+    using result_type = typename Variant::result_type;
+    using state_type  = typename Variant::state_type;
+
+    static constexpr std::uint64_t default_seed   = 0xcafef00dd15ea5e5;
+    static constexpr std::uint64_t default_stream = 0xa02bdbf7bb3c0a7;
+
+    /// Constructs the engine with a default seed
+    constexpr pcg_engine() noexcept
+        : pcg_engine(default_seed)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seed
+    ///     Value used to seed the engine
+    /// - stream
+    ///     Selects the output sequence. Only the lower `sizeof(state_type) * CHAR_BIT - 1` bits are used.
+    constexpr explicit pcg_engine(state_type seed, state_type stream = default_stream) noexcept
+        : m_state(0u)
+        , m_inc(0u)
+    {
+        this->seed(seed, stream);
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize both the state and the stream
+    template<seed_sequence S>
+    constexpr explicit pcg_engine(S&& seq)
+        : m_state(0u)
+        , m_inc(0u)
+    {
+        this->seed(seq);
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(state_type seed = default_seed, state_type stream = default_stream) noexcept
+    {
+        m_inc   = (stream << 1u) | state_type(1u);
+        m_state = detail::pcg_engine::step<state_type>(0u, Variant::multiplier, m_inc);
+        m_state += seed;
+        m_state = detail::pcg_engine::step(m_state, Variant::multiplier, m_inc);
+    }
+
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        auto const [state, stream] = detail::pcg_engine::seed_from<state_type>(seq);
+        seed(state, stream);
+    }
+
+    /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
+    /// function will return the next number in the sequence).
+    ///
+    /// # Return Value
+    /// A pseudo-random number in [`min`, `max`].
+    ///
+    /// # Complexity
+    /// Constant.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        state_type const old = m_state;
+        m_state              = detail::pcg_engine::step(m_state, Variant::multiplier, m_inc);
+        return Variant::output(old);
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Parameters
+    /// - z
+    ///     The number of times to advance the internal state
+    ///
+    /// # Complexity
+    /// Logarithmic in `z`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to calling `operator()` `z` times.
+    constexpr void discard(unsigned long long z) noexcept
+    {
+        m_state = detail::pcg_engine::advance(m_state, z, Variant::multiplier, m_inc);
+    }
+
+    /// Returns the stream the engine was seeded with.
+    [[nodiscard]] constexpr auto stream() const noexcept -> state_type { return m_inc >> 1u; }
+
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 2 * sizeof(state_type) / sizeof(std::uint64_t)>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array
+    {
+        if constexpr (std::same_as<state_type, detail::uint128>)
+            return {m_state.hi, m_state.lo, m_inc.hi, m_inc.lo};
+        else
+            return {m_state, m_inc};
+    }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> pcg_engine
+    {
+        pcg_engine e;
+        if constexpr (std::same_as<state_type, detail::uint128>)
+        {
+            e.m_state = {state[0], state[1]};
+            e.m_inc   = {state[2], state[3]};
+        }
+        else
+        {
+            e.m_state = state[0];
+            e.m_inc   = state[1];
+        }
+        return e;
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return -1; }
+
+    /// Compares two engine objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(pcg_engine const& lhs, pcg_engine const& rhs) -> bool = default;
+
+  private:
+    state_type m_state;
+    state_type m_inc;
+};
+
+/// Defines the pcg32 engine (XSH-RR output on 64 bit state) from
+/// "PCG: A Family of Simple Fast Space-Efficient Statistically Good Algorithms for Random Number Generation" by
+/// O'Neill, 2014.
+using pcg32 = pcg_engine<detail::pcg_engine::xsh_rr_64_32>;
+/// Defines the pcg64 engine with DXSM output on 128 bit state, as used by NumPy's `PCG64DXSM`.
+using pcg64 = pcg_engine<detail::pcg_engine::dxsm_128_64>;
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_PCG_ENGINE_HPP
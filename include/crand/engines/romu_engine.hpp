@@ -0,0 +1,266 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_ROMU_ENGINE_HPP
+#define CONSTEXPR_RANDOM_ROMU_ENGINE_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "detail/romu_engine_details.hpp"
+
+#include <array>
+#include <bit>
+
+#include <cstdint>
+
+namespace crand
+{
+/// Random number engine based on the RomuTrio algorithm.
+///
+/// A nonlinear rotate-multiply generator with 192 bits of state. Very fast, with statistical quality sufficient for
+/// most non-cryptographic purposes. The period depends on the seed, but is astronomically long for any practical use.
+class romu_trio
+{
+  public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type default_seed = 1;
+
+    /// Constructs the engine with a default seed
+    constexpr romu_trio() noexcept
+        : romu_trio(default_seed)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seed
+    ///     Value used to seed the engine
+    constexpr explicit romu_trio(result_type value) noexcept
+        : m_state(detail::romu_engine::seed<3>(value))
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the complete state
+    template<seed_sequence S>
+    constexpr explicit romu_trio(S&& seq)
+        : m_state(detail::romu_engine::seed_from<3>(seq))
+    {
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(result_type value = default_seed) noexcept { m_state = detail::romu_engine::seed<3>(value); }
+
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::romu_engine::seed_from<3>(seq);
+    }
+
+    /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
+    /// function will return the next number in the sequence).
+    ///
+    /// # Return Value
+    /// A pseudo-random number in [`min`, `max`].
+    ///
+    /// # Complexity
+    /// Constant.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        auto const [x, y, z] = m_state;
+        m_state[0]           = detail::romu_engine::multiplier * z;
+        m_state[1]           = std::rotl(y - x, 12);
+        m_state[2]           = std::rotl(z - y, 44);
+        return x;
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Parameters
+    /// - z
+    ///     The number of times to advance the internal state
+    ///
+    /// # Complexity
+    /// Linear in `z`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to calling `operator()` `z` times.
+    constexpr void discard(unsigned long long z) noexcept
+    {
+        for (unsigned long long i = 0; i < z; ++i)
+            operator()();
+    }
+
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 3>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return m_state; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> romu_trio
+    {
+        romu_trio e;
+        e.m_state = state;
+        return e;
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return -1; }
+
+    /// Compares two engine objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(romu_trio const& lhs, romu_trio const& rhs) -> bool = default;
+
+  private:
+    std::array<std::uint64_t, 3> m_state;
+};
+
+/// Random number engine based on the RomuDuo algorithm.
+///
+/// A nonlinear rotate-multiply generator with 128 bits of state. Slightly faster than `romu_trio` in some
+/// environments, at the cost of a smaller state.
+class romu_duo
+{
+  public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type default_seed = 1;
+
+    /// Constructs the engine with a default seed
+    constexpr romu_duo() noexcept
+        : romu_duo(default_seed)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seed
+    ///     Value used to seed the engine
+    constexpr explicit romu_duo(result_type value) noexcept
+        : m_state(detail::romu_engine::seed<2>(value))
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the complete state
+    template<seed_sequence S>
+    constexpr explicit romu_duo(S&& seq)
+        : m_state(detail::romu_engine::seed_from<2>(seq))
+    {
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(result_type value = default_seed) noexcept { m_state = detail::romu_engine::seed<2>(value); }
+
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::romu_engine::seed_from<2>(seq);
+    }
+
+    /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
+    /// function will return the next number in the sequence).
+    ///
+    /// # Return Value
+    /// A pseudo-random number in [`min`, `max`].
+    ///
+    /// # Complexity
+    /// Constant.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        auto const [x, y] = m_state;
+        m_state[0]        = detail::romu_engine::multiplier * y;
+        m_state[1]        = std::rotl(y, 36) + std::rotl(y, 15) - x;
+        return x;
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Parameters
+    /// - z
+    ///     The number of times to advance the internal state
+    ///
+    /// # Complexity
+    /// Linear in `z`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to calling `operator()` `z` times.
+    constexpr void discard(unsigned long long z) noexcept
+    {
+        for (unsigned long long i = 0; i < z; ++i)
+            operator()();
+    }
+
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 2>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return m_state; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> romu_duo
+    {
+        romu_duo e;
+        e.m_state = state;
+        return e;
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return -1; }
+
+    /// Compares two engine objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(romu_duo const& lhs, romu_duo const& rhs) -> bool = default;
+
+  private:
+    std::array<std::uint64_t, 2> m_state;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_ROMU_ENGINE_HPP
@@ -0,0 +1,176 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SEED_SEQ_HPP
+#define CONSTEXPR_RANDOM_SEED_SEQ_HPP
+
+#include "detail/seed_seq_details.hpp"
+
+#include <array>
+#include <concepts>
+#include <initializer_list>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Produces seed values of high quality from seed material of arbitrary length.
+///
+/// The seed material is mixed into a fixed-size pool of 256 bits at construction, which makes this type usable in
+/// constant expressions and cheap to copy. Every engine can be constructed and re-seeded from it, using as many bits
+/// as its state requires.
+///
+/// # Example
+/// ```
+/// constexpr crand::seed_seq seq{__DATE__ " " __TIME__ " " __FILE__};
+/// constexpr crand::xoshiro256_starstar e{seq};
+/// ```
+///
+/// # Notes
+/// - `seed_seq` satisfies `seed_sequence`.
+/// - Unlike `std::seed_seq`, integers wider than 32 bits are not truncated, and the original seed material is not
+///   retained.
+class seed_seq
+{
+  public:
+    using result_type = std::uint32_t;
+
+    /// Constructs a seed sequence without seed material
+    constexpr seed_seq() noexcept
+        : m_pool(detail::seed_seq::entropy_pool{}.finish())
+    {
+    }
+
+    /// Constructs a seed sequence from a list of integers
+    template<std::integral T>
+    constexpr seed_seq(std::initializer_list<T> material) noexcept
+        : seed_seq(material.begin(), material.end())
+    {
+    }
+
+    /// Constructs a seed sequence from a range of integers
+    ///
+    /// # Parameters
+    /// - first, last
+    ///     The range of integers. Every integer contributes all of its bits.
+    template<std::input_iterator It, std::sentinel_for<It> S>
+        requires std::integral<std::iter_value_t<It>>
+    constexpr seed_seq(It first, S last)
+        : m_pool()
+    {
+        detail::seed_seq::entropy_pool p;
+        for (; first != last; ++first)
+        {
+            auto const value = static_cast<std::make_unsigned_t<std::iter_value_t<It>>>(*first);
+            if constexpr (sizeof(value) > sizeof(std::uint32_t))
+                p.absorb64(value);
+            else
+                p.absorb(value);
+        }
+        m_pool = p.finish();
+    }
+
+    /// Constructs a seed sequence from the characters of a string, e.g. `__DATE__` and `__TIME__`
+    constexpr explicit seed_seq(std::string_view material) noexcept
+        : m_pool()
+    {
+        detail::seed_seq::entropy_pool p;
+        for (std::size_t i = 0; i < material.size(); i += 4)
+        {
+            std::uint32_t word = 0;
+            for (std::size_t j = 0; j < 4 && i + j < material.size(); ++j)
+                word |= std::uint32_t{static_cast<unsigned char>(material[i + j])} << (8 * j);
+            p.absorb(word);
+        }
+        p.absorb64(material.size());
+        m_pool = p.finish();
+    }
+
+    /// Fills [`first`, `last`) with seed values
+    ///
+    /// # Complexity
+    /// Linear in `std::distance(first, last)`.
+    ///
+    /// # Notes
+    /// Produces the same values every time it is called.
+    template<std::output_iterator<result_type> It, std::sentinel_for<It> S>
+    constexpr void generate(It first, S last) const
+    {
+        std::uint32_t hash_const = detail::seed_seq::init_b;
+        for (std::size_t i = 0; first != last; ++first, ++i)
+        {
+            std::uint32_t value = m_pool[i % m_pool.size()];
+            value ^= hash_const;
+            hash_const *= detail::seed_seq::mult_b;
+            value *= hash_const;
+            *first = value ^ (value >> detail::seed_seq::xshift);
+        }
+    }
+
+    /// Derives the `index`-th child seed sequence. Different children produce unrelated seed values.
+    [[nodiscard]] constexpr auto spawn(std::uint64_t index) const noexcept -> seed_seq
+    {
+        detail::seed_seq::entropy_pool p;
+        for (auto const word : m_pool)
+            p.absorb(word);
+        p.absorb64(index);
+        return seed_seq{p.finish()};
+    }
+
+    /// Compares two seed sequences by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(seed_seq const& lhs, seed_seq const& rhs) noexcept -> bool = default;
+
+  private:
+    constexpr explicit seed_seq(std::array<std::uint32_t, detail::seed_seq::pool_size> const& pool) noexcept
+        : m_pool(pool)
+    {
+    }
+
+    std::array<std::uint32_t, detail::seed_seq::pool_size> m_pool;
+};
+
+/// Constructs `N` engines, each seeded from a different child of `seq`.
+///
+/// # Notes
+/// The `i`-th engine is seeded from `seq.spawn(i)`.
+template<typename Engine, std::size_t N>
+constexpr auto make_engines(seed_seq const& seq) -> std::array<Engine, N>
+{
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>)
+    {
+        return std::array<Engine, N>{Engine{seq.spawn(Is)}...};
+    }
+    (std::make_index_sequence<N>{});
+}
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SEED_SEQ_HPP
@@ -0,0 +1,134 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SERIALIZATION_HPP
+#define CONSTEXPR_RANDOM_SERIALIZATION_HPP
+
+#include "crand/concepts/serializable_engine.hpp"
+#include "detail/little_endian.hpp"
+
+#include <array>
+#include <istream>
+#include <ostream>
+#include <span>
+
+#include <cstddef>
+
+namespace crand
+{
+/// The size in bytes of the binary representation of `E`'s state.
+template<serializable_engine E>
+inline constexpr std::size_t serialized_size_v
+    = std::tuple_size_v<typename E::state_array> * sizeof(typename E::state_array::value_type);
+
+/// Serializes the state of an engine into a fixed-size binary representation.
+///
+/// # Parameters
+/// - e
+///     The engine to serialize
+///
+/// # Return Value
+/// The words of `e.state()` in order, each stored in little-endian byte order.
+///
+/// # Notes
+/// The representation is independent of the platform's endianness, so it can be exchanged between machines and stored
+/// in checkpoint files. Use `from_bytes` to restore the engine.
+template<serializable_engine E>
+[[nodiscard]] constexpr auto to_bytes(E const& e) noexcept -> std::array<std::byte, serialized_size_v<E>>
+{
+    constexpr std::size_t width = sizeof(typename E::state_array::value_type);
+
+    std::array<std::byte, serialized_size_v<E>> result{};
+    auto const                                  state = e.state();
+    for (std::size_t i = 0; i < state.size(); ++i)
+        detail::store_le(result.data() + i * width, state[i]);
+    return result;
+}
+
+/// Restores an engine from its binary representation.
+///
+/// # Parameters
+/// - bytes
+///     Bytes previously obtained through `to_bytes`
+///
+/// # Return Value
+/// An engine comparing equal to the one that was serialized.
+template<serializable_engine E>
+[[nodiscard]] constexpr auto from_bytes(std::span<std::byte const, serialized_size_v<E>> bytes) noexcept -> E
+{
+    using word_type             = typename E::state_array::value_type;
+    constexpr std::size_t width = sizeof(word_type);
+
+    typename E::state_array state{};
+    for (std::size_t i = 0; i < state.size(); ++i)
+        state[i] = detail::load_le<word_type>(bytes.data() + i * width);
+    return E::from_state(state);
+}
+
+/// Writes the state of an engine to a stream.
+///
+/// # Notes
+/// - As for the standard library engines, the state is written as decimal numbers separated by spaces. The formatting
+///   flags and fill character of `os` are left unchanged.
+template<typename CharT, typename Traits, serializable_engine E>
+auto operator<<(std::basic_ostream<CharT, Traits>& os, E const& e) -> std::basic_ostream<CharT, Traits>&
+{
+    auto const flags = os.flags(std::ios_base::dec | std::ios_base::left);
+    auto const fill  = os.fill(os.widen(' '));
+
+    auto const state = e.state();
+    for (std::size_t i = 0; i < state.size(); ++i)
+    {
+        if (i > 0)
+            os << os.widen(' ');
+        os << state[i];
+    }
+
+    os.flags(flags);
+    os.fill(fill);
+    return os;
+}
+
+/// Reads the state of an engine from a stream.
+///
+/// # Notes
+/// - Accepts the format written by `operator<<`. If reading fails, `e` is left unchanged and the failbit of `is` is
+///   set. The formatting flags of `is` are left unchanged.
+template<typename CharT, typename Traits, serializable_engine E>
+auto operator>>(std::basic_istream<CharT, Traits>& is, E& e) -> std::basic_istream<CharT, Traits>&
+{
+    auto const flags = is.flags(std::ios_base::dec | std::ios_base::skipws);
+
+    typename E::state_array state{};
+    for (auto& word : state)
+        is >> word;
+    if (is)
+        e = E::from_state(state);
+
+    is.flags(flags);
+    return is;
+}
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SERIALIZATION_HPP
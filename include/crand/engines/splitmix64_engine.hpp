@@ -25,8 +25,15 @@
 #ifndef CONSTEXPR_RANDOM_SPLITMIX64_ENGINE_HPP
 #define CONSTEXPR_RANDOM_SPLITMIX64_ENGINE_HPP
 
+#include "crand/concepts/seed_sequence.hpp"
+#include "detail/cpu_dispatch.hpp"
+#include "detail/seed_from_sequence.hpp"
+
+#include <array>
 #include <bit>
+#include <span>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace crand
@@ -70,9 +77,28 @@ class splitmix64_engine
     {
     }
 
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the state; the default gamma is used
+    template<seed_sequence S>
+    constexpr explicit splitmix64_engine(S&& seq)
+        : m_state(detail::seed_from_sequence<result_type, 1>(seq)[0])
+        , m_gamma(default_gamma)
+    {
+    }
+
     /// Re-seeds the engine
     constexpr void seed(result_type seed = default_seed) noexcept { m_state = seed; }
 
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::seed_from_sequence<result_type, 1>(seq)[0];
+    }
+
     /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
     /// function will return the next number in the sequence).
     ///
@@ -85,14 +111,47 @@ class splitmix64_engine
     {
         auto x = m_state;
         m_state += m_gamma;
-        x ^= x >> s;
-        x *= m3;
-        x ^= x >> t;
-        x *= m4;
-        x ^= x >> u;
+        mix(x);
         return x;
     }
 
+    /// Advances `state`, laid out like `state_array`, and stores the value generated from it in `out`.
+    ///
+    /// # Notes
+    /// Each word of `state` may also be a vector of words, one per independent stream; see `interleaved_engine`.
+    template<typename V>
+    static constexpr void advance(std::array<V, 2>& state, V& out) noexcept
+    {
+        out = state[0];
+        state[0] += state[1];
+        mix(out);
+    }
+
+    /// Fills `out` with consecutive pseudo-random values.
+    ///
+    /// # Parameters
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    /// Linear in `out.size()`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to assigning the result of `operator()` to each element of `out`. At runtime, blocks of
+    /// values are computed independently of each other, using the widest vector instructions the CPU supports.
+    constexpr void generate(std::span<result_type> out) noexcept
+    {
+        namespace cd = detail::cpu_dispatch;
+        if consteval
+        {
+            fill<cd::isa::portable>(out);
+        }
+        else
+        {
+            cd::invoke([&](auto target) { fill<decltype(target)::value>(out); });
+        }
+    }
+
     /// Advances the state by z.
     ///
     /// # Parameters
@@ -124,6 +183,24 @@ class splitmix64_engine
         return splitmix64_engine{seed, g};
     }
 
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 2>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return {m_state, m_gamma}; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> splitmix64_engine
+    {
+        splitmix64_engine e;
+        e.m_state = state[0];
+        e.m_gamma = state[1];
+        return e;
+    }
+
     /// Returns the minimum potentially generated value.
     static constexpr auto min() noexcept -> result_type { return 0; }
     /// Returns the maximum potentially generated value.
@@ -136,6 +213,46 @@ class splitmix64_engine
     friend constexpr auto operator==(splitmix64_engine const& lhs, splitmix64_engine const& rhs) -> bool = default;
 
   private:
+    // Takes `x` by reference, since passing vectors by value would depend on the instruction set.
+    template<typename V>
+    static constexpr void mix(V& x) noexcept
+    {
+        x ^= x >> s;
+        x *= m3;
+        x ^= x >> t;
+        x *= m4;
+        x ^= x >> u;
+    }
+
+    // The values of a block only depend on the state at its start, so they can be computed in parallel. The state is
+    // kept in local variables, since stores to `out` could otherwise alias it.
+    template<detail::cpu_dispatch::isa Target>
+    constexpr void fill(std::span<result_type> out) noexcept
+    {
+        auto const gamma = m_gamma;
+        auto       state = m_state;
+        if constexpr (Target != detail::cpu_dispatch::isa::portable)
+        {
+            constexpr std::size_t block = detail::cpu_dispatch::block_size;
+            for (; out.size() >= block; out = out.subspan(block))
+            {
+                for (std::size_t i = 0; i < block; ++i)
+                {
+                    out[i] = state + i * gamma;
+                    mix(out[i]);
+                }
+                state += block * gamma;
+            }
+        }
+        for (auto& x : out)
+        {
+            x = state;
+            mix(x);
+            state += gamma;
+        }
+        m_state = state;
+    }
+
     result_type m_state;
     result_type m_gamma;
 };
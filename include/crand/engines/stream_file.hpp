@@ -0,0 +1,330 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_STREAM_FILE_HPP
+#define CONSTEXPR_RANDOM_STREAM_FILE_HPP
+
+#include "crand/concepts/serializable_engine.hpp"
+#include "detail/little_endian.hpp"
+#include "detail/stream_file_details.hpp"
+#include "generate.hpp"
+#include "serialization.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Describes the contents of a random stream file.
+///
+/// A stream file holds pre-generated engine output in a layout suitable for memory mapping. All values are stored in
+/// little-endian byte order:
+/// - A header of 128 bytes with the fields below
+/// - `count` values of `word_bytes` bytes each, starting at `data_offset()`
+/// - `checkpoint_count()` serialized engine states (see `to_bytes`), starting at `checkpoint_offset()`. Checkpoint `k`
+///   is the state of the engine before it produced value `k * checkpoint_interval`.
+struct stream_file_header
+{
+    /// Identifies the engine that produced the stream; not null-terminated if all 32 characters are used.
+    std::array<char, detail::stream_file::engine_id_size> engine{};
+    /// The seed the engine was constructed with. Only recorded for reference.
+    std::uint64_t seed = 0;
+    /// Number of stored values.
+    std::uint64_t count = 0;
+    /// Number of values between two consecutive checkpoints.
+    std::uint64_t checkpoint_interval = 0;
+    /// Size of one value in bytes.
+    std::uint32_t word_bytes = 0;
+    /// Size of one serialized engine state in bytes.
+    std::uint32_t state_bytes = 0;
+
+    /// Returns the engine identifier.
+    [[nodiscard]] constexpr auto engine_id() const noexcept -> std::string_view
+    {
+        return {engine.data(), static_cast<std::size_t>(std::ranges::find(engine, '\0') - engine.begin())};
+    }
+
+    /// Returns the number of stored checkpoints.
+    [[nodiscard]] constexpr auto checkpoint_count() const noexcept -> std::uint64_t
+    {
+        return count / checkpoint_interval + 1;
+    }
+
+    /// Returns the offset of the first value from the beginning of the file.
+    [[nodiscard]] static constexpr auto data_offset() noexcept -> std::uint64_t
+    {
+        return detail::stream_file::header_size;
+    }
+
+    /// Returns the offset of the first checkpoint from the beginning of the file.
+    [[nodiscard]] constexpr auto checkpoint_offset() const noexcept -> std::uint64_t
+    {
+        return detail::stream_file::align8(data_offset() + count * word_bytes);
+    }
+
+    /// Returns the total size of the file.
+    [[nodiscard]] constexpr auto file_size() const noexcept -> std::uint64_t
+    {
+        return checkpoint_offset() + checkpoint_count() * state_bytes;
+    }
+
+    /// Returns the binary representation of the header.
+    [[nodiscard]] constexpr auto encode() const noexcept -> std::array<std::byte, detail::stream_file::header_size>
+    {
+        namespace sf = detail::stream_file;
+
+        auto const to_byte = [](char c) { return static_cast<std::byte>(c); };
+
+        std::array<std::byte, sf::header_size> bytes{};
+        std::ranges::transform(sf::magic, bytes.begin(), to_byte);
+        detail::store_le(bytes.data() + sf::version_offset, sf::version);
+        detail::store_le(bytes.data() + sf::word_bytes_offset, word_bytes);
+        detail::store_le(bytes.data() + sf::state_bytes_offset, state_bytes);
+        detail::store_le(bytes.data() + sf::seed_offset, seed);
+        detail::store_le(bytes.data() + sf::count_offset, count);
+        detail::store_le(bytes.data() + sf::checkpoint_interval_offset, checkpoint_interval);
+        std::ranges::transform(engine, bytes.begin() + sf::engine_id_offset, to_byte);
+        return bytes;
+    }
+
+    /// Reads the header of a stream file.
+    ///
+    /// # Parameters
+    /// - file
+    ///     The contents of the file, or at least its first 128 bytes
+    ///
+    /// # Return Value
+    /// The header, or an empty optional if `file` doesn't start with a valid header.
+    [[nodiscard]] static constexpr auto decode(std::span<std::byte const> file) noexcept
+        -> std::optional<stream_file_header>
+    {
+        namespace sf = detail::stream_file;
+
+        auto const to_char = [](std::byte b) { return static_cast<char>(b); };
+
+        if (file.size() < sf::header_size)
+            return std::nullopt;
+        if (!std::ranges::equal(sf::magic, file.first(sf::magic.size()), {}, {}, to_char))
+            return std::nullopt;
+        if (detail::load_le<std::uint32_t>(file.data() + sf::version_offset) != sf::version)
+            return std::nullopt;
+
+        stream_file_header header;
+        header.word_bytes          = detail::load_le<std::uint32_t>(file.data() + sf::word_bytes_offset);
+        header.state_bytes         = detail::load_le<std::uint32_t>(file.data() + sf::state_bytes_offset);
+        header.seed                = detail::load_le<std::uint64_t>(file.data() + sf::seed_offset);
+        header.count               = detail::load_le<std::uint64_t>(file.data() + sf::count_offset);
+        header.checkpoint_interval = detail::load_le<std::uint64_t>(file.data() + sf::checkpoint_interval_offset);
+        std::ranges::transform(file.subspan(sf::engine_id_offset, sf::engine_id_size), header.engine.begin(), to_char);
+
+        if (header.word_bytes == 0 || header.checkpoint_interval == 0)
+            return std::nullopt;
+        constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+        if (header.count > (max - sf::header_size - 7u) / header.word_bytes)
+            return std::nullopt;
+        if (header.state_bytes != 0
+            && header.checkpoint_count() > (max - header.checkpoint_offset()) / header.state_bytes)
+            return std::nullopt;
+        return header;
+    }
+
+    friend constexpr auto operator==(stream_file_header const&, stream_file_header const&) noexcept -> bool = default;
+};
+
+/// Writes the output of an engine as a stream file.
+///
+/// # Parameters
+/// - sink
+///     Invoked with consecutive chunks of the file as `std::span<std::byte const>`
+/// - engine
+///     The engine producing the values
+/// - engine_id
+///     Identifies the engine; at most 32 characters
+/// - seed
+///     The seed `engine` was constructed with. Only recorded for reference.
+/// - count
+///     Number of values to write
+/// - checkpoint_interval
+///     Number of values between two consecutive checkpoints; must be positive
+///
+/// # Complexity
+/// Linear in `count`. Additional memory is linear in the number of checkpoints.
+///
+/// # Notes
+/// A checkpoint is stored for every multiple of `checkpoint_interval` up to and including `count`. The last checkpoint
+/// therefore allows resuming the stream past its end.
+template<serializable_engine E, typename Sink>
+    requires std::invocable<Sink&, std::span<std::byte const>>
+constexpr void write_stream_file(Sink&&          sink,
+                                 E               engine,
+                                 std::string_view engine_id,
+                                 std::uint64_t    seed,
+                                 std::uint64_t    count,
+                                 std::uint64_t    checkpoint_interval)
+{
+    using result_type = std::invoke_result_t<E&>;
+    using checkpoint  = std::array<std::byte, serialized_size_v<E>>;
+
+    assert(engine_id.size() <= detail::stream_file::engine_id_size);
+    assert(checkpoint_interval > 0);
+
+    stream_file_header header;
+    std::ranges::copy(engine_id.substr(0, header.engine.size()), header.engine.begin());
+    header.seed                = seed;
+    header.count               = count;
+    header.checkpoint_interval = checkpoint_interval;
+    header.word_bytes          = sizeof(result_type);
+    header.state_bytes         = serialized_size_v<E>;
+
+    auto const encoded_header = header.encode();
+    sink(std::span<std::byte const>{encoded_header});
+
+    constexpr std::size_t                                   chunk_size = 1024;
+    std::array<result_type, chunk_size>                     values{};
+    std::array<std::byte, chunk_size * sizeof(result_type)> bytes{};
+    std::vector<checkpoint>                                 checkpoints;
+    checkpoints.reserve(static_cast<std::size_t>(header.checkpoint_count()));
+
+    for (std::uint64_t position = 0; position < count;)
+    {
+        std::uint64_t const offset = position % checkpoint_interval;
+        if (offset == 0)
+            checkpoints.push_back(to_bytes(engine));
+
+        auto const n = static_cast<std::size_t>(std::min<std::uint64_t>({chunk_size,
+                                                                          count - position,
+                                                                          checkpoint_interval - offset}));
+        auto const chunk = std::span{values}.first(n);
+        generate(engine, chunk);
+        for (std::size_t i = 0; i < n; ++i)
+            detail::store_le(bytes.data() + i * sizeof(result_type), chunk[i]);
+        sink(std::span<std::byte const>{bytes}.first(n * sizeof(result_type)));
+        position += n;
+    }
+    if (count % checkpoint_interval == 0)
+        checkpoints.push_back(to_bytes(engine));
+
+    std::array<std::byte, 8> const padding{};
+    auto const padding_size = static_cast<std::size_t>(header.checkpoint_offset() - header.data_offset()
+                                                       - count * sizeof(result_type));
+    sink(std::span<std::byte const>{padding}.first(padding_size));
+    for (auto const& c : checkpoints)
+        sink(std::span<std::byte const>{c});
+}
+
+/// Provides random access to the contents of a stream file, e.g. after mapping it into memory.
+///
+/// # Notes
+/// The view doesn't own the file contents; they must outlive the view.
+template<serializable_engine E>
+class stream_file_view
+{
+  public:
+    using result_type = std::invoke_result_t<E&>;
+
+    /// Opens a stream file.
+    ///
+    /// # Parameters
+    /// - file
+    ///     The complete contents of the file
+    /// - engine_id
+    ///     If not empty, the file is only accepted if it was written with this engine identifier
+    ///
+    /// # Return Value
+    /// A view of the file, or an empty optional if the file is malformed, truncated or doesn't match `E`.
+    [[nodiscard]] static constexpr auto open(std::span<std::byte const> file, std::string_view engine_id = {}) noexcept
+        -> std::optional<stream_file_view>
+    {
+        auto const header = stream_file_header::decode(file);
+        if (!header)
+            return std::nullopt;
+        if (header->word_bytes != sizeof(result_type) || header->state_bytes != serialized_size_v<E>)
+            return std::nullopt;
+        if (!engine_id.empty() && header->engine_id() != engine_id)
+            return std::nullopt;
+        if (file.size() < header->file_size())
+            return std::nullopt;
+        return stream_file_view{file, *header};
+    }
+
+    /// Returns the header of the file.
+    [[nodiscard]] constexpr auto header() const noexcept -> stream_file_header const& { return m_header; }
+
+    /// Returns the number of stored values.
+    [[nodiscard]] constexpr auto size() const noexcept -> std::uint64_t { return m_header.count; }
+
+    /// Returns the stored value at `position`.
+    ///
+    /// # Complexity
+    /// Constant.
+    [[nodiscard]] constexpr auto operator[](std::uint64_t position) const noexcept -> result_type
+    {
+        assert(position < size());
+        auto const offset = m_header.data_offset() + position * sizeof(result_type);
+        return detail::load_le<result_type>(m_file.data() + offset);
+    }
+
+    /// Returns an engine whose next output is the value at `position`.
+    ///
+    /// # Parameters
+    /// - position
+    ///     Position in the stream. May exceed `size()` to resume generation past the end of the file.
+    ///
+    /// # Complexity
+    /// The complexity of `E::discard` for at most `checkpoint_interval` values, plus the distance past the end of the
+    /// file.
+    [[nodiscard]] constexpr auto engine_at(std::uint64_t position) const noexcept -> E
+    {
+        std::uint64_t const k      = std::min(position / m_header.checkpoint_interval, m_header.checkpoint_count() - 1);
+        auto const          offset = static_cast<std::size_t>(m_header.checkpoint_offset() + k * m_header.state_bytes);
+
+        E engine = from_bytes<E>(m_file.subspan(offset).template first<serialized_size_v<E>>());
+        engine.discard(position - k * m_header.checkpoint_interval);
+        return engine;
+    }
+
+  private:
+    constexpr stream_file_view(std::span<std::byte const> file, stream_file_header const& header) noexcept
+        : m_file(file)
+        , m_header(header)
+    {
+    }
+
+    std::span<std::byte const> m_file;
+    stream_file_header         m_header;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_STREAM_FILE_HPP
@@ -0,0 +1,152 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_WYRAND_ENGINE_HPP
+#define CONSTEXPR_RANDOM_WYRAND_ENGINE_HPP
+
+#include "crand/concepts/seed_sequence.hpp"
+#include "detail/seed_from_sequence.hpp"
+#include "detail/uint128.hpp"
+
+#include <array>
+
+#include <cstdint>
+
+namespace crand
+{
+/// Random number engine based on the wyrand algorithm.
+///
+/// A weyl sequence whose state is scrambled by folding a 64x64->128 bit multiplication. Very fast, but not as well
+/// analyzed as the other engines; prefer it for hot loops with modest quality requirements.
+///
+/// # Notes
+/// The `wyrand` typedef defines the engine with the recommended parameter set.
+template<std::uint64_t increment, std::uint64_t mix>
+class wyrand_engine
+{
+  public:
+    using result_type                         = std::uint64_t;
+    static constexpr result_type default_seed = 0xbad0ff1ced15ea5e;
+
+    /// Constructs the engine with a default seed
+    constexpr wyrand_engine() noexcept
+        : wyrand_engine(default_seed)
+    {
+    }
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seed
+    ///     Value used to seed the engine
+    constexpr explicit wyrand_engine(result_type seed) noexcept
+        : m_state(seed)
+    {
+    }
+
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the complete state
+    template<seed_sequence S>
+    constexpr explicit wyrand_engine(S&& seq)
+        : m_state(detail::seed_from_sequence<result_type, 1>(seq)[0])
+    {
+    }
+
+    /// Re-seeds the engine
+    constexpr void seed(result_type seed = default_seed) noexcept { m_state = seed; }
+
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::seed_from_sequence<result_type, 1>(seq)[0];
+    }
+
+    /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
+    /// function will return the next number in the sequence).
+    ///
+    /// # Return Value
+    /// A pseudo-random number in [`min`, `max`].
+    ///
+    /// # Complexity
+    /// Constant.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        m_state += increment;
+        auto const r = detail::mul_64x64_128(m_state, m_state ^ mix);
+        return r.hi ^ r.lo;
+    }
+
+    /// Advances the state by z.
+    ///
+    /// # Parameters
+    /// - z
+    ///     The number of times to advance the internal state
+    ///
+    /// # Complexity
+    /// Constant.
+    ///
+    /// # Notes
+    /// Functionally equivalent to calling `operator()` `z` times, but constant instead of linear.
+    constexpr void discard(unsigned long long z) noexcept { m_state += z * increment; }
+
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 1>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return {m_state}; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> wyrand_engine
+    {
+        wyrand_engine e;
+        e.m_state = state[0];
+        return e;
+    }
+
+    /// Returns the minimum potentially generated value.
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    /// Returns the maximum potentially generated value.
+    static constexpr auto max() noexcept -> result_type { return -1; }
+
+    /// Compares two engine objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(wyrand_engine const& lhs, wyrand_engine const& rhs) -> bool = default;
+
+  private:
+    result_type m_state;
+};
+
+/// Defines the wyrand engine with the parameter set from the final version of wyhash by Wang Yi.
+using wyrand = wyrand_engine<0x2d358dccaa6c78a5, 0x8bb84b93962eacc9>;
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_WYRAND_ENGINE_HPP
@@ -25,8 +25,10 @@
 #ifndef CONSTEXPR_RANDOM_XORSHIFT_ENGINE_HPP
 #define CONSTEXPR_RANDOM_XORSHIFT_ENGINE_HPP
 
+#include "crand/concepts/seed_sequence.hpp"
 #include "detail/xorshift_engine_details.hpp"
 
+#include <array>
 #include <concepts>
 
 #include <cstdint>
@@ -61,9 +63,27 @@ class xorshift_engine
     {
     }
 
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the complete state
+    template<seed_sequence S>
+    constexpr explicit xorshift_engine(S&& seq)
+        : m_state(detail::xorshift_engine::seed_from<T>(seq))
+    {
+    }
+
     /// Re-seeds the engine
     constexpr void seed(result_type value = default_seed) noexcept { m_state = detail::xorshift_engine::seed(value); }
 
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::xorshift_engine::seed_from<T>(seq);
+    }
+
     /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
     /// function will return the next number in the sequence).
     ///
@@ -74,10 +94,24 @@ class xorshift_engine
     /// Constant.
     constexpr auto operator()() noexcept -> result_type
     {
-        m_state ^= m_state << a;
-        m_state ^= m_state >> b;
-        m_state ^= m_state << c;
-        return m_state;
+        std::array<T, 1> state{m_state};
+        result_type      x{};
+        advance(state, x);
+        m_state = state[0];
+        return x;
+    }
+
+    /// Advances `state`, laid out like `state_array`, and stores the value generated from it in `out`.
+    ///
+    /// # Notes
+    /// Each word of `state` may also be a vector of words, one per independent stream; see `interleaved_engine`.
+    template<typename V>
+    static constexpr void advance(std::array<V, 1>& state, V& out) noexcept
+    {
+        state[0] ^= state[0] << a;
+        state[0] ^= state[0] >> b;
+        state[0] ^= state[0] << c;
+        out = state[0];
     }
 
     /// Advances the state by z.
@@ -97,6 +131,23 @@ class xorshift_engine
             operator()();
     }
 
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<T, 1>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return {m_state}; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> xorshift_engine
+    {
+        xorshift_engine e;
+        e.m_state = state[0];
+        return e;
+    }
+
     /// Returns the minimum potentially generated value.
     static constexpr auto min() noexcept -> result_type { return 0; }
     /// Returns the maximum potentially generated value.
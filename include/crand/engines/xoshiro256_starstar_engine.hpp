@@ -25,8 +25,12 @@
 #ifndef CONSTEXPR_RANDOM_XOSHIRO256_STARSTAR_ENGINE_HPP
 #define CONSTEXPR_RANDOM_XOSHIRO256_STARSTAR_ENGINE_HPP
 
+#include "crand/concepts/seed_sequence.hpp"
 #include "detail/xoshiro256_starstar_details.hpp"
 
+#include <array>
+#include <span>
+
 #include <cstdint>
 
 namespace crand
@@ -55,12 +59,30 @@ class xoshiro256_starstar
     {
     }
 
+    /// Constructs the engine
+    ///
+    /// # Parameters
+    /// - seq
+    ///     Seed sequence used to initialize the complete state
+    template<seed_sequence S>
+    constexpr explicit xoshiro256_starstar(S&& seq)
+        : m_state(detail::xoshiro256_starstar::seed_from(seq))
+    {
+    }
+
     /// Re-seeds the engine
     constexpr void seed(result_type value = default_seed) noexcept
     {
         m_state = detail::xoshiro256_starstar::seed(value);
     }
 
+    /// Re-seeds the engine from a seed sequence
+    template<seed_sequence S>
+    constexpr void seed(S&& seq)
+    {
+        m_state = detail::xoshiro256_starstar::seed_from(seq);
+    }
+
     /// Generates a pseudo-random value. The engine state is advanced by one (the next call to this
     /// function will return the next number in the sequence).
     ///
@@ -71,6 +93,37 @@ class xoshiro256_starstar
     /// Constant.
     constexpr auto operator()() noexcept -> result_type { return detail::xoshiro256_starstar::advance_state(m_state); }
 
+    /// Fills `out` with consecutive pseudo-random values.
+    ///
+    /// # Parameters
+    /// - out
+    ///     The range to fill
+    ///
+    /// # Complexity
+    /// Linear in `out.size()`.
+    ///
+    /// # Notes
+    /// Functionally equivalent to assigning the result of `operator()` to each element of `out`, but keeps the state
+    /// in registers. Each value depends on the state left by the previous one, so, unlike for `splitmix64`, wider
+    /// vector instructions do not help here.
+    constexpr void generate(std::span<result_type> out) noexcept
+    {
+        auto state = m_state;
+        for (auto& x : out)
+            x = detail::xoshiro256_starstar::advance_state(state);
+        m_state = state;
+    }
+
+    /// Advances `state`, laid out like `state_array`, and stores the value generated from it in `out`.
+    ///
+    /// # Notes
+    /// Each word of `state` may also be a vector of words, one per independent stream; see `interleaved_engine`.
+    template<typename V>
+    static constexpr void advance(std::array<V, 4>& state, V& out) noexcept
+    {
+        detail::xoshiro256_starstar::advance_state(state, out);
+    }
+
     /// Advances the state by z.
     ///
     /// # Parameters
@@ -108,6 +161,23 @@ class xoshiro256_starstar
             {0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635}>(m_state);
     }
 
+    /// The complete engine state, as returned by `state()`.
+    using state_array = std::array<std::uint64_t, 4>;
+
+    /// Returns the complete internal state.
+    ///
+    /// # Notes
+    /// An engine with identical state can be obtained using `from_state`.
+    [[nodiscard]] constexpr auto state() const noexcept -> state_array { return m_state; }
+
+    /// Constructs an engine from a state previously obtained through `state()`.
+    [[nodiscard]] static constexpr auto from_state(state_array const& state) noexcept -> xoshiro256_starstar
+    {
+        xoshiro256_starstar e;
+        e.m_state = state;
+        return e;
+    }
+
     /// Returns the minimum potentially generated value.
     static constexpr auto min() noexcept -> result_type { return 0; }
     /// Returns the maximum potentially generated value.
@@ -0,0 +1,53 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HALTON_SEQUENCE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_HALTON_SEQUENCE_DETAILS_HPP
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::halton_sequence
+{
+/// Computes the first `D` primes.
+template<std::size_t D>
+[[nodiscard]] consteval auto first_primes() noexcept -> std::array<std::uint64_t, D>
+{
+    std::array<std::uint64_t, D> primes{};
+    std::size_t                  found = 0;
+    for (std::uint64_t n = 2; found < D; ++n)
+    {
+        bool prime = true;
+        for (std::size_t i = 0; i < found && primes[i] * primes[i] <= n; ++i)
+            prime = prime && n % primes[i] != 0;
+        if (prime)
+            primes[found++] = n;
+    }
+    return primes;
+}
+} // namespace crand::detail::halton_sequence
+
+#endif // CONSTEXPR_RANDOM_HALTON_SEQUENCE_DETAILS_HPP
@@ -0,0 +1,113 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_LOW_DISCREPANCY_DETAILS_HPP
+#define CONSTEXPR_RANDOM_LOW_DISCREPANCY_DETAILS_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/detail/tiny_splitmix64.hpp"
+
+#include <array>
+#include <concepts>
+#include <limits>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::low_discrepancy
+{
+/// Number of significant bits a coordinate of type `T` is produced with.
+template<std::floating_point T>
+inline constexpr int digits = std::numeric_limits<T>::digits < 64 ? std::numeric_limits<T>::digits : 64;
+
+/// `2^-digits<T>`, the spacing of the grid coordinates are produced on.
+template<std::floating_point T>
+inline constexpr T resolution = []
+{
+    T r = 1;
+    for (int i = 0; i < digits<T>; ++i)
+        r /= 2;
+    return r;
+}();
+
+/// The largest value of type `T` below `1`.
+template<std::floating_point T>
+inline constexpr T largest_below_one = T{1} - std::numeric_limits<T>::epsilon() / 2;
+
+/// Maps the binary fraction `0.b63 b62 ... b0` to [0, 1), keeping as many leading bits as `T` can represent.
+template<std::floating_point T>
+[[nodiscard]] constexpr auto to_unit(std::uint64_t fraction) noexcept -> T
+{
+    return static_cast<T>(fraction >> (64 - digits<T>)) * resolution<T>;
+}
+
+/// Stateless 64-bit mixing function.
+[[nodiscard]] constexpr auto mix(std::uint64_t x) noexcept -> std::uint64_t
+{
+    return tiny_splitmix64(&x);
+}
+
+/// Reverses the order of the bits of `x`.
+[[nodiscard]] constexpr auto reverse_bits(std::uint32_t x) noexcept -> std::uint32_t
+{
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+    x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+/// Hash-based Owen scrambling of the binary fraction `x` (Burley, "Practical Hash-based Owen Scrambling", 2020).
+///
+/// # Notes
+/// Each step of the Laine-Karras permutation only lets a bit influence more significant bits. Applied to the reversed
+/// fraction, every digit is thus flipped depending on the digits before it only, which is exactly Owen's nested
+/// uniform scrambling in base 2.
+[[nodiscard]] constexpr auto nested_uniform_scramble(std::uint32_t x, std::uint32_t seed) noexcept -> std::uint32_t
+{
+    x = reverse_bits(x);
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return reverse_bits(x);
+}
+
+/// Draws `N` full-width seeds from `g`.
+template<std::size_t N, crand::uniform_random_bit_generator G>
+[[nodiscard]] constexpr auto draw_seeds(G& g) -> std::array<std::uint64_t, N>
+{
+    constexpr crand::uniform_int_distribution<std::uint64_t> dist{
+        crand::inclusive<std::uint64_t>{0}, crand::inclusive{std::numeric_limits<std::uint64_t>::max()}};
+
+    std::array<std::uint64_t, N> seeds;
+    for (auto& s : seeds)
+        s = dist(g);
+    return seeds;
+}
+} // namespace crand::detail::low_discrepancy
+
+#endif // CONSTEXPR_RANDOM_LOW_DISCREPANCY_DETAILS_HPP
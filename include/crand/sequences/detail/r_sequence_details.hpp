@@ -0,0 +1,65 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_R_SEQUENCE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_R_SEQUENCE_DETAILS_HPP
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::r_sequence
+{
+/// Computes the generalized golden ratio of dimension `d`, the unique positive root of `x^(d+1) = x + 1`.
+[[nodiscard]] consteval auto generalized_golden_ratio(std::size_t d) noexcept -> double
+{
+    double x = 2;
+    for (int iteration = 0; iteration < 64; ++iteration)
+    {
+        double power = 1;
+        for (std::size_t i = 0; i < d; ++i)
+            power *= x;
+        x -= (power * x - x - 1) / (static_cast<double>(d + 1) * power - 1);
+    }
+    return x;
+}
+
+/// Computes the increments `phi^-1, ..., phi^-D` of the first `D` coordinates as 64-bit binary fractions.
+template<std::size_t D>
+[[nodiscard]] consteval auto make_increments() noexcept -> std::array<std::uint64_t, D>
+{
+    double const                 inv   = 1 / generalized_golden_ratio(D);
+    double                       alpha = 1;
+    std::array<std::uint64_t, D> result{};
+    for (auto& r : result)
+    {
+        alpha *= inv;
+        r = static_cast<std::uint64_t>(alpha * 0x1p64);
+    }
+    return result;
+}
+} // namespace crand::detail::r_sequence
+
+#endif // CONSTEXPR_RANDOM_R_SEQUENCE_DETAILS_HPP
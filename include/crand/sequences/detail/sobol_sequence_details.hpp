@@ -0,0 +1,110 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SOBOL_SEQUENCE_DETAILS_HPP
+#define CONSTEXPR_RANDOM_SOBOL_SEQUENCE_DETAILS_HPP
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace crand::detail::sobol_sequence
+{
+/// A primitive polynomial over GF(2) together with the initial direction numbers of its dimension.
+struct primitive_polynomial
+{
+    /// Degree `s` of the polynomial
+    unsigned degree;
+    /// Coefficients of `x^(s-1)` to `x^1`, most significant bit first
+    unsigned coefficients;
+    /// The odd initial direction numbers `m_1, ..., m_s` with `m_k < 2^k`
+    std::array<std::uint32_t, 7> initial;
+};
+
+/// Parameters of dimensions 2 and up, taken from the `new-joe-kuo-6.21201` table by Joe and Kuo. The first dimension
+/// is the van der Corput sequence and needs no polynomial.
+inline constexpr std::array<primitive_polynomial, 20> polynomials{{
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+}};
+
+/// The maximum number of dimensions supported.
+inline constexpr std::size_t max_dimensions = polynomials.size() + 1;
+
+/// Number of direction numbers per dimension, i.e. the base-2 logarithm of the sequence's period.
+inline constexpr std::size_t bits = 64;
+
+/// The direction numbers `v_1, ..., v_64` of a dimension as 64-bit binary fractions.
+using directions = std::array<std::uint64_t, bits>;
+
+/// Computes the direction numbers of the first `D` dimensions.
+///
+/// # Complexity
+///     Linear in `D`.
+template<std::size_t D>
+[[nodiscard]] consteval auto make_directions() noexcept -> std::array<directions, D>
+{
+    std::array<directions, D> result{};
+    for (std::size_t k = 0; k < bits; ++k)
+        result[0][k] = std::uint64_t{1} << (bits - 1 - k);
+
+    for (std::size_t i = 1; i < D; ++i)
+    {
+        auto const& p = polynomials[i - 1];
+        auto&       v = result[i];
+        auto const  s = std::size_t{p.degree};
+        for (std::size_t k = 0; k < s; ++k)
+            v[k] = std::uint64_t{p.initial[k]} << (bits - 1 - k);
+        for (std::size_t k = s; k < bits; ++k)
+        {
+            v[k] = v[k - s] ^ (v[k - s] >> s);
+            for (std::size_t j = 1; j < s; ++j)
+                if ((p.coefficients >> (s - 1 - j)) & 1u)
+                    v[k] ^= v[k - j];
+        }
+    }
+    return result;
+}
+} // namespace crand::detail::sobol_sequence
+
+#endif // CONSTEXPR_RANDOM_SOBOL_SEQUENCE_DETAILS_HPP
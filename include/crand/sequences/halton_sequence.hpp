@@ -0,0 +1,219 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HALTON_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_HALTON_SEQUENCE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/structure_of_arrays.hpp"
+#include "crand/engines/detail/uint128.hpp"
+#include "crand/sequences/detail/halton_sequence_details.hpp"
+#include "crand/sequences/detail/low_discrepancy_details.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <utility>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Produces the points of the `D`-dimensional Halton sequence in [0, 1)^D.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates
+///
+/// # Notes
+/// - Coordinate `i` of point `n` is the radical inverse of `n` in the `i`-th prime base, i.e. the digits of `n` in
+///   that base mirrored at the decimal point. Every run of `b^m` points starting at a multiple of `b^m` hits each
+///   interval of length `b^-m` exactly once in the coordinate of base `b`.
+/// - The quality of the projections degrades for large bases, so prefer `sobol_sequence` beyond a dozen dimensions.
+/// - `scrambled` creates a randomized copy of the sequence by shifting each digit, including the infinitely many
+///   trailing zeros, by a random amount that depends on the digits before it. In base 2 this is Owen's nested uniform
+///   scrambling, for larger bases it is a cheaper variant with the same stratification properties.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0)
+class halton_sequence
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Creates the unscrambled sequence, starting at the origin.
+    constexpr halton_sequence() noexcept = default;
+
+    /// Creates a scrambled sequence with an independent scramble per coordinate.
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator` to draw the scramble from
+    ///
+    /// # Return Value
+    ///     The scrambled sequence, starting at its first point.
+    template<uniform_random_bit_generator G>
+    [[nodiscard]] static constexpr auto scrambled(G& g) -> halton_sequence
+    {
+        halton_sequence s;
+        s.m_seeds     = detail::low_discrepancy::draw_seeds<D>(g);
+        s.m_scrambled = true;
+        return s;
+    }
+
+    /// Returns the current point and advances to the next one.
+    ///
+    /// # Return Value
+    ///     The point at `index()` before the call.
+    ///
+    /// # Complexity
+    ///     Linear in `D` times the number of digits of `index()`.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        result_type point;
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            if (m_scrambled)
+                ((point[I] = scrambled_inverse<I>()), ...);
+            else
+                ((point[I] = radical_inverse<I>()), ...);
+        }(std::make_index_sequence<D>{});
+        ++m_index;
+        return point;
+    }
+
+    /// Produces the next `out.size() / D` points in structure-of-arrays layout.
+    ///
+    /// # Parameters
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     `out.size() / D` times the complexity of `operator()`.
+    constexpr void generate(std::span<RealType> out) noexcept
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+        for (std::size_t j = 0; j < m; ++j)
+            detail::scatter((*this)(), out, m, j);
+    }
+
+    /// Jumps to the point with the given index.
+    ///
+    /// # Complexity
+    ///     Constant.
+    constexpr void seek(std::uint64_t index) noexcept { m_index = index; }
+
+    /// Advances the sequence by `z` points.
+    ///
+    /// # Complexity
+    ///     Constant.
+    constexpr void discard(unsigned long long z) noexcept { m_index += z; }
+
+    /// Returns the index of the next point to be produced.
+    [[nodiscard]] constexpr auto index() const noexcept -> std::uint64_t { return m_index; }
+
+    /// Returns whether the sequence is scrambled.
+    [[nodiscard]] constexpr auto is_scrambled() const noexcept -> bool { return m_scrambled; }
+
+    /// Returns the prime base of each coordinate.
+    [[nodiscard]] static constexpr auto bases() noexcept -> std::array<std::uint64_t, D> const& { return s_bases; }
+
+    /// Compares two sequence objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(halton_sequence const&, halton_sequence const&) noexcept -> bool = default;
+
+  private:
+    // The base is a template parameter so that the divisions compile to multiplications.
+    template<std::size_t I>
+    [[nodiscard]] constexpr auto radical_inverse() const noexcept -> RealType
+    {
+        constexpr auto base = s_bases[I];
+        constexpr auto inv  = RealType{1} / static_cast<RealType>(base);
+
+        RealType weight = inv;
+        RealType result = 0;
+        for (auto n = m_index; n != 0; n /= base)
+        {
+            result += static_cast<RealType>(n % base) * weight;
+            weight *= inv;
+        }
+        return std::min(result, detail::low_discrepancy::largest_below_one<RealType>);
+    }
+
+    // Every node of the digit tree, i.e. digit position k together with the value p of the digits before it, is
+    // assigned the fraction V(p) hashed from the seed and p; digit k is shifted by digit k of V(p). Once the digits of
+    // the index are exhausted, the remaining infinitely many scrambled zeros are exactly the remaining digits of V(p),
+    // so they are added at once. Digits whose weight is below 2^-64 are dropped.
+    template<std::size_t I>
+    [[nodiscard]] constexpr auto scrambled_inverse() const noexcept -> RealType
+    {
+        constexpr auto base      = s_bases[I];
+        constexpr auto inv       = RealType{1} / static_cast<RealType>(base);
+        constexpr auto max_power = std::numeric_limits<std::uint64_t>::max() / base;
+
+        RealType      weight = 1;
+        RealType      result = 0;
+        std::uint64_t prefix = 0;
+        std::uint64_t power  = 1;
+        for (auto n = m_index; n != 0; n /= base)
+        {
+            if (power > max_power)
+                return std::min(result, detail::low_discrepancy::largest_below_one<RealType>);
+
+            auto const node  = detail::low_discrepancy::mix(m_seeds[I] ^ prefix);
+            auto const shift = (detail::uint128{node} * detail::uint128{power * base}).hi % base;
+            auto const digit = n % base;
+            weight *= inv;
+            result += static_cast<RealType>((digit + shift) % base) * weight;
+            prefix += digit * power;
+            power *= base;
+        }
+        auto const node = detail::low_discrepancy::mix(m_seeds[I] ^ prefix);
+        auto const tail = (detail::uint128{node} * detail::uint128{power}).lo;
+        result += detail::low_discrepancy::to_unit<RealType>(tail) * weight;
+        return std::min(result, detail::low_discrepancy::largest_below_one<RealType>);
+    }
+
+    static constexpr auto s_bases = detail::halton_sequence::first_primes<D>();
+
+    std::array<std::uint64_t, D> m_seeds{};
+    std::uint64_t                m_index     = 0;
+    bool                         m_scrambled = false;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_HALTON_SEQUENCE_HPP
@@ -0,0 +1,173 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_R_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_R_SEQUENCE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/sequences/detail/low_discrepancy_details.hpp"
+#include "crand/sequences/detail/r_sequence_details.hpp"
+
+#include <array>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Produces the points of Roberts' `D`-dimensional R-sequence in [0, 1)^D.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates
+///
+/// # Notes
+/// - Point `n` is the fractional part of `s + n * (phi^-1, ..., phi^-D)`, where `phi` is the generalized golden ratio
+///   of dimension `D` and `s` the offset, which is zero for the unrandomized sequence. Unlike the Halton sequence,
+///   its quality doesn't degrade with the number of dimensions.
+/// - Coordinates are kept as 64-bit binary fractions, so they are exact modulo 1 for any index.
+/// - As a lattice sequence it can't be Owen-scrambled: `scrambled` randomizes it with a random offset per coordinate
+///   instead (Cranley-Patterson rotation), which also makes the points unbiased estimators.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0)
+class r_sequence
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Creates the unrandomized sequence, starting at the origin.
+    constexpr r_sequence() noexcept = default;
+
+    /// Creates a sequence with an independent random offset per coordinate.
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator` to draw the offsets from
+    ///
+    /// # Return Value
+    ///     The randomized sequence, starting at its first point.
+    template<uniform_random_bit_generator G>
+    [[nodiscard]] static constexpr auto scrambled(G& g) -> r_sequence
+    {
+        r_sequence s;
+        s.m_offset    = detail::low_discrepancy::draw_seeds<D>(g);
+        s.m_state     = s.m_offset;
+        s.m_scrambled = true;
+        return s;
+    }
+
+    /// Returns the current point and advances to the next one.
+    ///
+    /// # Return Value
+    ///     The point at `index()` before the call.
+    ///
+    /// # Complexity
+    ///     Linear in `D`.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        result_type point;
+        for (std::size_t i = 0; i < D; ++i)
+        {
+            point[i] = detail::low_discrepancy::to_unit<RealType>(m_state[i]);
+            m_state[i] += s_increments[i];
+        }
+        ++m_index;
+        return point;
+    }
+
+    /// Produces the next `out.size() / D` points in structure-of-arrays layout.
+    ///
+    /// # Parameters
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     Linear in `out.size()`.
+    constexpr void generate(std::span<RealType> out) noexcept
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+        for (std::size_t i = 0; i < D; ++i)
+        {
+            auto state = m_state[i];
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                out[i * m + j] = detail::low_discrepancy::to_unit<RealType>(state);
+                state += s_increments[i];
+            }
+            m_state[i] = state;
+        }
+        m_index += m;
+    }
+
+    /// Jumps to the point with the given index.
+    ///
+    /// # Complexity
+    ///     Linear in `D`.
+    constexpr void seek(std::uint64_t index) noexcept
+    {
+        m_index = index;
+        for (std::size_t i = 0; i < D; ++i)
+            m_state[i] = m_offset[i] + index * s_increments[i];
+    }
+
+    /// Advances the sequence by `z` points.
+    ///
+    /// # Complexity
+    ///     Linear in `D`.
+    constexpr void discard(unsigned long long z) noexcept { seek(m_index + z); }
+
+    /// Returns the index of the next point to be produced.
+    [[nodiscard]] constexpr auto index() const noexcept -> std::uint64_t { return m_index; }
+
+    /// Returns whether the sequence is randomized.
+    [[nodiscard]] constexpr auto is_scrambled() const noexcept -> bool { return m_scrambled; }
+
+    /// Compares two sequence objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(r_sequence const&, r_sequence const&) noexcept -> bool = default;
+
+  private:
+    static constexpr auto s_increments = detail::r_sequence::make_increments<D>();
+
+    std::array<std::uint64_t, D> m_state{};
+    std::array<std::uint64_t, D> m_offset{};
+    std::uint64_t                m_index     = 0;
+    bool                         m_scrambled = false;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_R_SEQUENCE_HPP
@@ -0,0 +1,191 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_SOBOL_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_SOBOL_SEQUENCE_HPP
+
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/sequences/detail/low_discrepancy_details.hpp"
+#include "crand/sequences/detail/sobol_sequence_details.hpp"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <span>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace crand
+{
+/// Produces the points of the `D`-dimensional Sobol sequence in [0, 1)^D.
+///
+/// # Parameters
+/// - RealType
+///     The type of the coordinates
+/// - D
+///     The number of coordinates, at most 21
+///
+/// # Notes
+/// - The direction numbers are those of Joe and Kuo and are computed at compile time.
+/// - Points are enumerated in Gray code order, so consecutive points differ by a single direction number per
+///   coordinate. Every run of `2^m` points starting at a multiple of `2^m` is a (t, m, D)-net in base 2; in particular
+///   every coordinate of such a run hits each interval of length `2^-m` exactly once.
+/// - `scrambled` creates an Owen-scrambled copy of the sequence, randomized by an engine, which keeps the net
+///   properties while making the points unbiased estimators. Scrambled coordinates have full 32-bit precision, any
+///   further bits are random.
+/// - `generate` produces many points at once in structure-of-arrays layout.
+template<std::floating_point RealType, std::size_t D>
+    requires(D > 0 && D <= detail::sobol_sequence::max_dimensions)
+class sobol_sequence
+{
+  public:
+    using result_type = std::array<RealType, D>;
+
+    /// Creates the unscrambled sequence, starting at the origin.
+    constexpr sobol_sequence() noexcept = default;
+
+    /// Creates an Owen-scrambled sequence with an independent scramble per coordinate.
+    ///
+    /// # Parameters
+    /// - g
+    ///     An object satisfying `uniform_random_bit_generator` to draw the scramble from
+    ///
+    /// # Return Value
+    ///     The scrambled sequence, starting at its first point.
+    template<uniform_random_bit_generator G>
+    [[nodiscard]] static constexpr auto scrambled(G& g) -> sobol_sequence
+    {
+        sobol_sequence s;
+        s.m_seeds     = detail::low_discrepancy::draw_seeds<D>(g);
+        s.m_scrambled = true;
+        return s;
+    }
+
+    /// Returns the current point and advances to the next one.
+    ///
+    /// # Return Value
+    ///     The point at `index()` before the call.
+    ///
+    /// # Complexity
+    ///     Linear in `D`.
+    constexpr auto operator()() noexcept -> result_type
+    {
+        result_type point;
+        for (std::size_t i = 0; i < D; ++i)
+            point[i] = coordinate(i, m_state[i]);
+
+        auto const c = static_cast<std::size_t>(std::countr_one(m_index));
+        for (std::size_t i = 0; i < D; ++i)
+            m_state[i] ^= s_directions[i][c];
+        ++m_index;
+        return point;
+    }
+
+    /// Produces the next `out.size() / D` points in structure-of-arrays layout.
+    ///
+    /// # Parameters
+    /// - out
+    ///     `D` consecutive rows of `M = out.size() / D` values each: Coordinate `i` of point `j` is written to
+    ///     `out[i * M + j]`.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `out.size()` isn't a multiple of `D`.
+    ///
+    /// # Complexity
+    ///     Linear in `out.size()`.
+    constexpr void generate(std::span<RealType> out) noexcept
+    {
+        assert(out.size() % D == 0);
+        auto const m = out.size() / D;
+        for (std::size_t i = 0; i < D; ++i)
+        {
+            auto state = m_state[i];
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                out[i * m + j] = coordinate(i, state);
+                state ^= s_directions[i][static_cast<std::size_t>(std::countr_one(m_index + j))];
+            }
+            m_state[i] = state;
+        }
+        m_index += m;
+    }
+
+    /// Jumps to the point with the given index.
+    ///
+    /// # Complexity
+    ///     Linear in `D` times the bit width of `index`.
+    constexpr void seek(std::uint64_t index) noexcept
+    {
+        m_index = index;
+        m_state = {};
+        for (auto gray = index ^ (index >> 1); gray != 0; gray &= gray - 1)
+        {
+            auto const k = static_cast<std::size_t>(std::countr_zero(gray));
+            for (std::size_t i = 0; i < D; ++i)
+                m_state[i] ^= s_directions[i][k];
+        }
+    }
+
+    /// Advances the sequence by `z` points.
+    ///
+    /// # Complexity
+    ///     Linear in `D` times the bit width of the new index.
+    constexpr void discard(unsigned long long z) noexcept { seek(m_index + z); }
+
+    /// Returns the index of the next point to be produced.
+    [[nodiscard]] constexpr auto index() const noexcept -> std::uint64_t { return m_index; }
+
+    /// Returns whether the sequence is scrambled.
+    [[nodiscard]] constexpr auto is_scrambled() const noexcept -> bool { return m_scrambled; }
+
+    /// Compares two sequence objects by their internal state.
+    ///
+    /// # Notes
+    /// Not visible to ordinary unqualified or qualified lookup, can only found via ADL.
+    friend constexpr auto operator==(sobol_sequence const&, sobol_sequence const&) noexcept -> bool = default;
+
+  private:
+    [[nodiscard]] constexpr auto coordinate(std::size_t i, std::uint64_t state) const noexcept -> RealType
+    {
+        if (!m_scrambled)
+            return detail::low_discrepancy::to_unit<RealType>(state);
+
+        auto const high = detail::low_discrepancy::nested_uniform_scramble(static_cast<std::uint32_t>(state >> 32),
+                                                                           static_cast<std::uint32_t>(m_seeds[i]));
+        auto const low  = detail::low_discrepancy::mix(m_seeds[i] ^ high) >> 32;
+        return detail::low_discrepancy::to_unit<RealType>((std::uint64_t{high} << 32) | low);
+    }
+
+    static constexpr auto s_directions = detail::sobol_sequence::make_directions<D>();
+
+    std::array<std::uint64_t, D> m_state{};
+    std::array<std::uint64_t, D> m_seeds{};
+    std::uint64_t                m_index     = 0;
+    bool                         m_scrambled = false;
+};
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_SOBOL_SEQUENCE_HPP
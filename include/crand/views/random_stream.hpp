@@ -0,0 +1,202 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_RANDOM_STREAM_HPP
+#define CONSTEXPR_RANDOM_RANDOM_STREAM_HPP
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/generate_n.hpp"
+
+#include <coroutine>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_generator)
+#include <generator>
+#endif
+
+#include <cassert>
+#include <cstddef>
+
+namespace crand
+{
+#if defined(__cpp_lib_generator)
+/// Coroutine yielding chunks of random values.
+template<typename T>
+using random_stream = std::generator<std::span<T const>>;
+#else
+/// Coroutine yielding chunks of random values.
+///
+/// A minimal stand-in for `std::generator<std::span<T const>>` on standard libraries that don't provide it yet. It is
+/// a move-only input view whose elements are the yielded chunks.
+///
+/// # Notes
+/// - Only `co_yield` of chunks is supported; `co_await` and `co_yield ranges::elements_of(...)` are not.
+/// - Exceptions thrown by the coroutine body propagate out of `begin()` or `operator++`.
+template<typename T>
+class random_stream : public std::ranges::view_interface<random_stream<T>>
+{
+  public:
+    using chunk_type = std::span<T const>;
+
+    class promise_type
+    {
+      public:
+        auto get_return_object() noexcept -> random_stream
+        {
+            return random_stream{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        auto initial_suspend() const noexcept -> std::suspend_always { return {}; }
+        auto final_suspend() const noexcept -> std::suspend_always { return {}; }
+        auto yield_value(chunk_type chunk) noexcept -> std::suspend_always
+        {
+            m_chunk = chunk;
+            return {};
+        }
+        void return_void() const noexcept {}
+        void unhandled_exception() const { throw; }
+
+        template<typename U>
+        auto await_transform(U&&) = delete;
+
+      private:
+        friend random_stream;
+
+        chunk_type m_chunk;
+    };
+
+    class iterator
+    {
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using difference_type  = std::ptrdiff_t;
+        using value_type       = chunk_type;
+
+        auto operator*() const noexcept -> chunk_type { return m_handle.promise().m_chunk; }
+
+        auto operator++() -> iterator&
+        {
+            m_handle.resume();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend auto operator==(iterator const& it, std::default_sentinel_t) noexcept -> bool
+        {
+            return it.m_handle.done();
+        }
+
+      private:
+        friend random_stream;
+
+        explicit iterator(std::coroutine_handle<promise_type> handle) noexcept
+            : m_handle(handle)
+        {
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    random_stream(random_stream const&) = delete;
+    random_stream(random_stream&& other) noexcept
+        : m_handle(std::exchange(other.m_handle, {}))
+    {
+    }
+    auto operator=(random_stream const&) -> random_stream& = delete;
+    auto operator=(random_stream&& other) noexcept -> random_stream&
+    {
+        std::swap(m_handle, other.m_handle);
+        return *this;
+    }
+    ~random_stream()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    /// Runs the coroutine up to its first chunk and returns an iterator to it.
+    ///
+    /// # Preconditions
+    /// Behavior is undefined if `begin()` is called more than once.
+    auto begin() -> iterator
+    {
+        m_handle.resume();
+        return iterator{m_handle};
+    }
+    /// Returns the sentinel marking the end of the coroutine.
+    auto end() const noexcept -> std::default_sentinel_t { return std::default_sentinel; }
+
+  private:
+    explicit random_stream(std::coroutine_handle<promise_type> handle) noexcept
+        : m_handle(handle)
+    {
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+#endif
+
+/// Produces an endless stream of chunks of values generated by `d` from `g`.
+///
+/// Each chunk is filled through `crand::generate_n`, so distributions with a batch path draw engine words in bulk,
+/// and the consumer is only resumed once per chunk instead of once per value.
+///
+/// # Parameters
+/// - g
+///     The engine to draw from. It is referenced, not copied, and must outlive the stream.
+/// - d
+///     The distribution to transform the engine output with
+/// - chunk_size
+///     The number of values per chunk
+///
+/// # Return Value
+///     A `random_stream` whose elements are the chunks. Each chunk is valid until the stream is resumed.
+///
+/// # Preconditions
+/// Behavior is undefined if `chunk_size` is `0`.
+///
+/// # Notes
+/// - The concatenated chunks are the same sequence as that of repeated invocations of `d(g)`.
+/// - A chunk is only generated when the stream is resumed, so a suspended consumer holds no more than one chunk.
+template<uniform_random_bit_generator G, random_number_distribution D>
+auto generate_chunks(G& g, D d, std::size_t chunk_size) -> random_stream<typename D::result_type>
+{
+    using result_type = typename D::result_type;
+
+    assert(chunk_size > 0);
+    auto const buffer = std::make_unique<result_type[]>(chunk_size);
+    for (;;)
+    {
+        crand::generate_n(d, g, buffer.get(), chunk_size);
+        co_yield std::span<result_type const>{buffer.get(), chunk_size};
+    }
+}
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_RANDOM_STREAM_HPP
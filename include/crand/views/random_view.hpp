@@ -0,0 +1,159 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_RANDOM_VIEW_HPP
+#define CONSTEXPR_RANDOM_RANDOM_VIEW_HPP
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/concepts/uniform_random_bit_generator.hpp"
+#include "crand/distributions/detail/generate_n_details.hpp"
+#include "crand/distributions/generate_n.hpp"
+
+#include <array>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+#include <cstddef>
+
+namespace crand
+{
+/// Infinite input range of values produced by a distribution from an engine.
+///
+/// Values are generated in blocks through `crand::generate_n`, so distributions with a batch path draw engine words
+/// in bulk. A block is only generated once a value of it is accessed.
+///
+/// # Notes
+/// - The engine is referenced, not copied, and must outlive the view. Blocks are generated ahead of use, so after
+///   consuming `n` values the engine has advanced as if up to `Block - 1` more values had been drawn.
+/// - The sequence of values is the same as that of repeated invocations of `d(g)`.
+/// - Like all input ranges, the view can only be iterated once; `begin()` continues where the last iteration stopped.
+///   The view is move-only, so to draw from the same view repeatedly, compose `std::ranges::ref_view{v}` instead of
+///   `v`.
+template<uniform_random_bit_generator G,
+         random_number_distribution   D,
+         std::size_t                  Block = detail::generate_n::batch_size>
+    requires(Block > 0)
+class random_view : public std::ranges::view_interface<random_view<G, D, Block>>
+{
+  public:
+    using result_type = typename D::result_type;
+
+    class iterator
+    {
+      public:
+        using iterator_concept = std::input_iterator_tag;
+        using difference_type  = std::ptrdiff_t;
+        using value_type       = result_type;
+
+        constexpr explicit iterator(random_view& parent) noexcept
+            : m_parent(std::addressof(parent))
+        {
+        }
+
+        constexpr auto operator*() const -> value_type { return m_parent->current(); }
+
+        constexpr auto operator++() -> iterator&
+        {
+            m_parent->advance();
+            return *this;
+        }
+        constexpr void operator++(int) { ++*this; }
+
+      private:
+        random_view* m_parent;
+    };
+
+    /// Constructs a view of the values `d` produces from `g`.
+    ///
+    /// # Parameters
+    /// - g
+    ///     The engine to draw from
+    /// - d
+    ///     The distribution to transform the engine output with
+    constexpr random_view(G& g, D d)
+        : m_engine(std::addressof(g))
+        , m_dist(std::move(d))
+    {
+    }
+
+    // Copies would replay the buffered values, so the view is move-only.
+    random_view(random_view const&)                    = delete;
+    random_view(random_view&&)                         = default;
+    auto operator=(random_view const&) -> random_view& = delete;
+    auto operator=(random_view&&) -> random_view&      = default;
+
+    /// Returns an iterator to the next value.
+    constexpr auto begin() -> iterator { return iterator{*this}; }
+    /// Returns a sentinel that is never reached.
+    constexpr auto end() const noexcept -> std::unreachable_sentinel_t { return std::unreachable_sentinel; }
+
+  private:
+    constexpr auto current() -> result_type
+    {
+        if (m_index == Block)
+            next_block();
+        return m_buffer[m_index];
+    }
+    // Skipped values are generated as well, so that the sequence doesn't depend on which values are read
+    constexpr void advance()
+    {
+        if (m_index == Block)
+            next_block();
+        ++m_index;
+    }
+    constexpr void next_block()
+    {
+        crand::generate_n(m_dist, *m_engine, m_buffer.begin(), Block);
+        m_index = 0;
+    }
+
+    G*                             m_engine;
+    D                              m_dist;
+    std::array<result_type, Block> m_buffer{};
+    std::size_t                    m_index = Block;
+};
+
+namespace detail::random_view
+{
+struct random_fn
+{
+    template<crand::uniform_random_bit_generator G, crand::random_number_distribution D>
+    constexpr auto operator()(G& g, D d) const -> crand::random_view<G, D>
+    {
+        return crand::random_view<G, D>{g, std::move(d)};
+    }
+};
+} // namespace detail::random_view
+
+namespace views
+{
+/// Creates a `random_view` of the values `d` produces from `g`, e.g.
+/// `crand::views::random(engine, dist) | std::views::take(n)`.
+inline constexpr detail::random_view::random_fn random{};
+} // namespace views
+} // namespace crand
+
+#endif // CONSTEXPR_RANDOM_RANDOM_VIEW_HPP
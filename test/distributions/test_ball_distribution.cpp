@@ -0,0 +1,92 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/ball_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <cmath>
+
+ASSERTING_FUNCTION(check_ball, (auto d, int runs))
+{
+    constexpr std::size_t      dims = std::tuple_size_v<typename decltype(d)::result_type>;
+    crand::xoshiro256_starstar e;
+
+    // For a uniform point in the unit ball, E[|x|^2] = D / (D + 2) and P(|x| < 1/2) = 2^-D
+    double mean_square = 0;
+    int    inner       = 0;
+    for (int i = 0; i < runs; ++i)
+    {
+        auto const p      = d(e);
+        double     square = 0;
+        for (auto const x : p)
+            square += x * x;
+        REQUIRE(square <= 1);
+        mean_square += square / runs;
+        inner += square < 0.25 ? 1 : 0;
+    }
+    REQUIRE(std::abs(mean_square - static_cast<double>(dims) / (dims + 2)) < 0.05);
+    REQUIRE(std::abs(static_cast<double>(inner) / runs - std::pow(0.5, dims)) < 0.05);
+
+    constexpr std::size_t points = 300;
+    std::vector<double>   out(dims * points);
+    d.generate(e, std::span{out});
+    for (std::size_t j = 0; j < points; ++j)
+    {
+        double square = 0;
+        for (std::size_t k = 0; k < dims; ++k)
+            square += out[k * points + j] * out[k * points + j];
+        REQUIRE(square <= 1 + 1e-12);
+    }
+}
+
+TEST_CASE("ball_distribution", "[distributions]")
+{
+    using namespace crand;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("disk")
+    {
+        CALL(check_ball, ball_distribution<double, 2>{}, runs);
+    }
+    SECTION("ball")
+    {
+        CALL(check_ball, ball_distribution<double, 3>{}, runs);
+    }
+    SECTION("higher dimensions")
+    {
+        CALL(check_ball, ball_distribution<double, 1>{}, runs);
+        CALL(check_ball, ball_distribution<double, 6>{}, runs);
+    }
+}
+EVAL_TEST_CASE("ball_distribution");
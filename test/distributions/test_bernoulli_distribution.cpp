@@ -76,5 +76,19 @@ TEST_CASE("bernoulli_distribution", "[distributions]")
             REQUIRE(n == true);
         }
     }
+
+    SECTION("param_type")
+    {
+        bernoulli_distribution d;
+        for (int i = 0; i < runs; ++i)
+        {
+            REQUIRE(!d(e, bernoulli_distribution::param_type{0.}));
+            REQUIRE(d(e, bernoulli_distribution::param_type{1.}));
+        }
+
+        d.param(bernoulli_distribution::param_type{0.25});
+        REQUIRE(d == bernoulli_distribution{0.25});
+        REQUIRE(d.param().p() == 0.25);
+    }
 }
 EVAL_TEST_CASE("bernoulli_distribution");
\ No newline at end of file
@@ -0,0 +1,133 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/compact_uniform_real_distribution.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+
+namespace
+{
+// Requires a compact and a regular distribution to agree on everything, including the values they produce
+ASSERTING_FUNCTION(helper_check_same, (auto c, auto u, int runs))
+{
+    crand::xoshiro256_starstar e1;
+    crand::xoshiro256_starstar e2;
+    REQUIRE(c.a() == u.a());
+    REQUIRE(c.b() == u.b());
+    REQUIRE(c.min() == u.min());
+    REQUIRE(c.max() == u.max());
+    REQUIRE(c.gamma() == u.gamma());
+    REQUIRE(c.num_unique_values() == u.num_unique_values());
+    for (int i = 0; i < runs; ++i)
+        REQUIRE(c(e1) == u(e2));
+}
+} // namespace
+
+TEST_CASE("compact_uniform_real_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 100;
+    else
+        runs = 10000;
+
+    SECTION("satisfies batch_random_number_distribution")
+    {
+        REQUIRE(batch_random_number_distribution<compact_uniform_real_distribution<double>>);
+        REQUIRE(batch_random_number_distribution<compact_uniform_real_distribution<float>>);
+    }
+
+    SECTION("size")
+    {
+        REQUIRE(sizeof(compact_uniform_real_distribution<double>) <= 32);
+        REQUIRE(sizeof(compact_uniform_real_distribution<float>) <= 16);
+    }
+
+    SECTION("same values as uniform_real_distribution")
+    {
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{0.}, inclusive{1.}),
+             uniform_real_distribution(inclusive{0.}, inclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{42.}, inclusive{42.}),
+             uniform_real_distribution(inclusive{42.}, inclusive{42.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{-3.}, inclusive{1.}),
+             uniform_real_distribution(inclusive{-3.}, inclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(exclusive{0.}, inclusive{1.}),
+             uniform_real_distribution(exclusive{0.}, inclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(exclusive{-3.}, inclusive{1.}),
+             uniform_real_distribution(exclusive{-3.}, inclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{0.}, exclusive{1.}),
+             uniform_real_distribution(inclusive{0.}, exclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{-3.}, exclusive{1.}),
+             uniform_real_distribution(inclusive{-3.}, exclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(exclusive{0.1}, exclusive{0.7}),
+             uniform_real_distribution(exclusive{0.1}, exclusive{0.7}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(exclusive{-3.}, exclusive{1.}),
+             uniform_real_distribution(exclusive{-3.}, exclusive{1.}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(inclusive{-1.f}, inclusive{1.f}),
+             uniform_real_distribution(inclusive{-1.f}, inclusive{1.f}),
+             runs);
+        CALL(helper_check_same,
+             compact_uniform_real_distribution(exclusive{-5.f}, exclusive{2.5f}),
+             uniform_real_distribution(exclusive{-5.f}, exclusive{2.5f}),
+             runs);
+    }
+
+    SECTION("generate")
+    {
+        compact_uniform_real_distribution const d(exclusive{-2.}, inclusive{3.});
+        std::array<double, 100>                 batch{};
+        auto                                    e2 = e;
+        d.generate(e, batch);
+        for (auto const x : batch)
+            REQUIRE(x == d(e2));
+        REQUIRE(e == e2);
+    }
+}
+EVAL_TEST_CASE("compact_uniform_real_distribution");
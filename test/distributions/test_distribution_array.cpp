@@ -0,0 +1,102 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/bernoulli_distribution.hpp"
+#include "crand/distributions/compact_uniform_real_distribution.hpp"
+#include "crand/distributions/distribution_array.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <vector>
+
+TEST_CASE("distribution_array", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    SECTION("compact_uniform_real_distribution")
+    {
+        using dist = compact_uniform_real_distribution<double>;
+        std::vector<dist> ds;
+        for (int i = 0; i < 150; ++i)
+        {
+            auto const a = -1. * (i % 7) - 0.25 * i;
+            auto const b = 0.5 * (i % 5) + 0.125;
+            switch (i % 4)
+            {
+            case 0:
+                ds.push_back(dist(inclusive{a}, inclusive{b}));
+                break;
+            case 1:
+                ds.push_back(dist(exclusive{a}, inclusive{b}));
+                break;
+            case 2:
+                ds.push_back(dist(inclusive{a}, exclusive{b}));
+                break;
+            default:
+                ds.push_back(dist(exclusive{a}, exclusive{b}));
+                break;
+            }
+        }
+
+        distribution_array<dist> const array(ds);
+        REQUIRE(array.size() == ds.size());
+        for (std::size_t i = 0; i < ds.size(); ++i)
+            REQUIRE(array[i] == ds[i]);
+
+        std::vector<double> out(ds.size());
+        auto                e2 = e;
+        array.generate(e, out);
+        for (std::size_t i = 0; i < ds.size(); ++i)
+        {
+            REQUIRE(out[i] == ds[i](e2));
+            REQUIRE(out[i] >= ds[i].min());
+            REQUIRE(out[i] <= ds[i].max());
+        }
+        REQUIRE(e == e2);
+
+        distribution_array<dist> pushed;
+        pushed.reserve(ds.size());
+        for (auto const& d : ds)
+            pushed.push_back(d);
+        REQUIRE(pushed == array);
+    }
+
+    SECTION("other distributions")
+    {
+        std::array const ds{bernoulli_distribution(0.1), bernoulli_distribution(0.5), bernoulli_distribution(0.9)};
+        distribution_array<bernoulli_distribution> array(ds);
+        REQUIRE(array.size() == ds.size());
+        REQUIRE(array[1] == ds[1]);
+
+        std::array<bool, 3> out{};
+        auto                e2 = e;
+        array.generate(e, out);
+        for (std::size_t i = 0; i < ds.size(); ++i)
+            REQUIRE(out[i] == ds[i](e2));
+        REQUIRE(e == e2);
+    }
+}
+EVAL_TEST_CASE("distribution_array");
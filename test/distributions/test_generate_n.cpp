@@ -0,0 +1,166 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/bernoulli_distribution.hpp"
+#include "crand/distributions/compact_uniform_real_distribution.hpp"
+#include "crand/distributions/generate_n.hpp"
+#include "crand/distributions/half_normal_distribution.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/distributions/static_uniform_int_distribution.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/distributions/uniform_real_distribution.hpp"
+#include "crand/engines/bit_buffer.hpp"
+#include "crand/engines/chacha_engine.hpp"
+#include "crand/engines/detail/cpu_dispatch.hpp"
+#include "crand/engines/splitmix64_engine.hpp"
+#include "crand/engines/xorshift_engine.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+/// Checks that `generate_n` produces the same values and leaves `d` and `g` in the same state as repeated `d(g)`.
+template<typename D, typename G>
+constexpr auto matches_scalar(D d, G g, std::size_t n) -> bool
+{
+    auto d_copy = d;
+    auto g_copy = g;
+
+    std::vector<typename D::result_type> expected;
+    for (std::size_t i = 0; i < n; ++i)
+        expected.push_back(d_copy(g_copy));
+
+    std::vector<typename D::result_type> actual(n);
+    auto const                           end = crand::generate_n(d, g, actual.begin(), n);
+    return end == actual.end() && actual == expected && d == d_copy && g == g_copy;
+}
+} // namespace
+
+TEST_CASE("generate_n", "[distributions]")
+{
+    using namespace crand;
+
+    SECTION("batch_random_number_distribution")
+    {
+        REQUIRE(batch_random_number_distribution<uniform_int_distribution<int>>);
+        REQUIRE(batch_random_number_distribution<uniform_real_distribution<double>>);
+        REQUIRE(batch_random_number_distribution<bernoulli_distribution>);
+        REQUIRE(batch_random_number_distribution<normal_distribution<double>>);
+        REQUIRE(batch_random_number_distribution<static_uniform_int_distribution<int, 1, 6>>);
+        REQUIRE(!batch_random_number_distribution<half_normal_distribution<double>>);
+    }
+    SECTION("uniform_int_distribution")
+    {
+        uniform_int_distribution const dice{inclusive{1}, inclusive{6}};
+        uniform_int_distribution const octal{inclusive{0}, inclusive{7}};
+        REQUIRE(matches_scalar(dice, xoshiro256_starstar{}, 0));
+        REQUIRE(matches_scalar(dice, xoshiro256_starstar{}, 1));
+        REQUIRE(matches_scalar(dice, xoshiro256_starstar{}, 200));
+        REQUIRE(matches_scalar(octal, xorshift32{}, 200));
+        REQUIRE(matches_scalar(dice, chacha8{}, 200));
+        REQUIRE(matches_scalar(dice, bit_buffer<xoshiro256_starstar>{}, 200));
+
+        uniform_int_distribution<std::uint64_t> const wide{inclusive<std::uint64_t>{3},
+                                                           inclusive<std::uint64_t>{std::uint64_t{1} << 40u}};
+        REQUIRE(matches_scalar(wide, xorshift32{}, 100));
+    }
+    SECTION("uniform_real_distribution")
+    {
+        uniform_real_distribution const d{inclusive{-2.}, exclusive{3.}};
+        REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 200));
+        REQUIRE(matches_scalar(d, xorshift32{}, 100));
+    }
+    SECTION("bernoulli_distribution")
+    {
+        bernoulli_distribution const d{0.3};
+        REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 200));
+        REQUIRE(matches_scalar(d, bit_buffer<xoshiro256_starstar>{}, 200));
+    }
+    SECTION("normal_distribution")
+    {
+        normal_distribution d{1., 2.};
+        REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 200));
+        REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 201));
+
+        xoshiro256_starstar e;
+        d(e);
+        REQUIRE(matches_scalar(d, e, 7));
+    }
+    SECTION("kernels of every supported instruction set")
+    {
+        if !consteval
+        {
+            namespace cd = detail::cpu_dispatch;
+            uniform_real_distribution const         d{exclusive{-2.}, inclusive{3.}};
+            uniform_real_distribution const         f{inclusive{0.f}, exclusive{1.f}};
+            compact_uniform_real_distribution const c{inclusive{-.5}, exclusive{.25}};
+            for (int isa = 0; isa <= static_cast<int>(cd::detect()); ++isa)
+            {
+                CAPTURE(isa);
+                cd::selected = static_cast<cd::isa>(isa);
+                REQUIRE(matches_scalar(d, splitmix64{}, 200));
+                REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 37));
+                REQUIRE(matches_scalar(f, splitmix64{}, 200));
+                REQUIRE(matches_scalar(c, splitmix64{}, 100));
+            }
+            cd::selected = cd::detect();
+        }
+    }
+    SECTION("static_uniform_int_distribution")
+    {
+        REQUIRE(matches_scalar(static_uniform_int_distribution<int, 1, 6>{}, xoshiro256_starstar{}, 200));
+        REQUIRE(matches_scalar(static_uniform_int_distribution<int, 0, 7>{}, xorshift32{}, 200));
+    }
+    SECTION("distributions without a batch path")
+    {
+        half_normal_distribution const d{2.};
+        REQUIRE(matches_scalar(d, xoshiro256_starstar{}, 50));
+    }
+    SECTION("non-contiguous output")
+    {
+        uniform_int_distribution const dice{inclusive{1}, inclusive{6}};
+        xoshiro256_starstar            e;
+        auto                           engine_copy = e;
+
+        std::vector<int> actual;
+        generate_n(dice, e, std::back_inserter(actual), 150);
+        REQUIRE(actual.size() == 150);
+        for (auto const x : actual)
+            REQUIRE(x == dice(engine_copy));
+        REQUIRE(e == engine_copy);
+    }
+    SECTION("const distributions")
+    {
+        bernoulli_distribution const d{0.5};
+        xoshiro256_starstar          e;
+        std::array<bool, 10>         out{};
+        REQUIRE(generate_n(d, e, out.begin(), out.size()) == out.end());
+    }
+}
+EVAL_TEST_CASE("generate_n");
@@ -0,0 +1,89 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/half_normal_distribution.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <cmath>
+
+TEST_CASE("half_normal_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("satisfies random_number_distribution")
+    {
+        REQUIRE(random_number_distribution<half_normal_distribution<>>);
+    }
+    SECTION("absolute values of a normal distribution")
+    {
+        half_normal_distribution d{2.};
+        normal_distribution      normal{0., 2.};
+        auto                     engine_copy = e;
+        REQUIRE(d.sigma() == 2.);
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(e) == std::abs(normal(engine_copy)));
+    }
+    SECTION("mean")
+    {
+        // Expected mean: 2 * sqrt(2 / pi) = 1.5958
+        half_normal_distribution d{2.};
+        double                   sum = 0;
+        for (int i = 0; i < runs; ++i)
+        {
+            auto const x = d(e);
+            REQUIRE(x >= 0);
+            sum += x;
+        }
+        REQUIRE(sum / runs > 1.5);
+        REQUIRE(sum / runs < 1.7);
+    }
+    SECTION("param_type")
+    {
+        using param_type = half_normal_distribution<double>::param_type;
+
+        half_normal_distribution d;
+        normal_distribution      normal;
+        auto                     engine_copy = e;
+        for (int i = 0; i < 100; ++i)
+        {
+            param_type const p{1. + i % 3};
+            REQUIRE(d(e, p) == std::abs(normal(engine_copy) * p.sigma()));
+        }
+
+        d.param(param_type{3.});
+        REQUIRE(d.sigma() == 3.);
+        REQUIRE(d.param() == param_type{3.});
+    }
+}
+EVAL_TEST_CASE("half_normal_distribution");
@@ -0,0 +1,149 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/multivariate_normal_distribution.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <cmath>
+
+namespace
+{
+constexpr auto approx(double a, double b, double tolerance = 1e-12) -> bool
+{
+    return std::abs(a - b) <= tolerance;
+}
+} // namespace
+
+TEST_CASE("multivariate_normal_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    using dist3 = multivariate_normal_distribution<double, 3>;
+
+    constexpr std::array<double, 3>                mean{1., -2., 10.};
+    constexpr std::array<std::array<double, 3>, 3> covariance{{{4., 2., -1.}, {2., 3., 0.5}, {-1., 0.5, 2.}}};
+
+    SECTION("Cholesky factor")
+    {
+        multivariate_normal_distribution<double, 2> d{{0., 0.}, {{{4., 2.}, {2., 3.}}}};
+        auto const&                                 l = d.cholesky_factor();
+        REQUIRE(l[0][0] == 2.);
+        REQUIRE(l[0][1] == 0.);
+        REQUIRE(l[1][0] == 1.);
+        REQUIRE(approx(l[1][1], std::sqrt(2.)));
+
+        constexpr dist3 d3{mean, covariance};
+        auto const      c = d3.covariance();
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                REQUIRE(approx(c[i][j], covariance[i][j]));
+    }
+    SECTION("default construction")
+    {
+        dist3 d;
+        REQUIRE(d.mean() == std::array{0., 0., 0.});
+        REQUIRE(d.covariance() == std::array<std::array<double, 3>, 3>{{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}}});
+    }
+    SECTION("sample mean and covariance")
+    {
+        dist3                              d{mean, covariance};
+        std::vector<std::array<double, 3>> samples;
+        for (int i = 0; i < runs; ++i)
+            samples.push_back(d(e));
+
+        std::array<double, 3> m{};
+        for (auto const& s : samples)
+            for (std::size_t i = 0; i < 3; ++i)
+                m[i] += s[i] / runs;
+        for (std::size_t i = 0; i < 3; ++i)
+            REQUIRE(approx(m[i], mean[i], 0.25));
+
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+            {
+                double c = 0;
+                for (auto const& s : samples)
+                    c += (s[i] - m[i]) * (s[j] - m[j]) / (runs - 1);
+                REQUIRE(approx(c, covariance[i][j], 0.5));
+            }
+    }
+    SECTION("generate writes structure-of-arrays rows")
+    {
+        // More columns than fit into one block
+        constexpr std::size_t vectors = 300;
+        dist3                 d{mean, covariance};
+        auto                  engine_copy = e;
+
+        std::vector<double> out(3 * vectors);
+        d.generate(e, std::span{out});
+
+        normal_distribution standard;
+        std::vector<double> z(3 * vectors);
+        standard.generate(engine_copy, std::span{z});
+
+        auto const& l = d.cholesky_factor();
+        for (std::size_t j = 0; j < vectors; ++j)
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                double expected = mean[i];
+                for (std::size_t k = 0; k <= i; ++k)
+                    expected += l[i][k] * z[k * vectors + j];
+                REQUIRE(approx(out[i * vectors + j], expected, 1e-9));
+            }
+        REQUIRE(e == engine_copy);
+    }
+    SECTION("param_type")
+    {
+        dist3::param_type const p{mean, covariance};
+        dist3                   d;
+        dist3                   reference{mean, covariance};
+        auto                    engine_copy = e;
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(d(e, p) == reference(engine_copy));
+
+        std::vector<double> out(30);
+        std::vector<double> expected(30);
+        d.generate(e, std::span{out}, p);
+        reference.generate(engine_copy, std::span{expected});
+        REQUIRE(out == expected);
+
+        d.param(p);
+        REQUIRE(d == reference);
+        REQUIRE(d.param().mean() == mean);
+    }
+}
+EVAL_TEST_CASE("multivariate_normal_distribution");
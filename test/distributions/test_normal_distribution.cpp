@@ -134,5 +134,22 @@ TEST_CASE("normal_distribution", "[distributions]")
         REQUIRE(n <= d.max());
     }
     REQUIRE(check_normality(samples, 5., 2.));
+
+    SECTION("param_type")
+    {
+        // Cached values are standard normal and transformed by the parameters of the call that returns them
+        normal_distribution<double> standard;
+        normal_distribution<double> switching;
+        auto                        e2 = e;
+        for (int i = 0; i < 100; ++i)
+        {
+            normal_distribution<double>::param_type const p{static_cast<double>(i), 1. + i % 3};
+            REQUIRE(switching(e2, p) == standard(e) * p.stddev() + p.mean());
+        }
+
+        switching.param(normal_distribution<double>::param_type{5., 2.});
+        REQUIRE(switching.mean() == 5.);
+        REQUIRE(switching.stddev() == 2.);
+    }
 }
 EVAL_TEST_CASE("normal_distribution");
\ No newline at end of file
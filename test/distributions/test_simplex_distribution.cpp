@@ -0,0 +1,95 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/simplex_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <cmath>
+
+ASSERTING_FUNCTION(check_simplex, (auto d, int runs))
+{
+    constexpr std::size_t      dims = std::tuple_size_v<typename decltype(d)::result_type>;
+    crand::xoshiro256_starstar e;
+
+    std::array<double, dims> mean{};
+    for (int i = 0; i < runs; ++i)
+    {
+        auto const p   = d(e);
+        double     sum = 0;
+        for (std::size_t k = 0; k < dims; ++k)
+        {
+            REQUIRE(p[k] >= 0);
+            sum += p[k];
+            mean[k] += p[k] / runs;
+        }
+        REQUIRE(std::abs(sum - 1) < 1e-12);
+    }
+    for (auto const m : mean)
+        REQUIRE(std::abs(m - 1. / dims) < 0.05);
+
+    constexpr std::size_t points = 100;
+    std::vector<double>   out(dims * points);
+    auto                  engine_copy = e;
+    d.generate(e, std::span{out});
+    for (std::size_t j = 0; j < points; ++j)
+    {
+        auto const p = d(engine_copy);
+        for (std::size_t k = 0; k < dims; ++k)
+            REQUIRE(out[k * points + j] == p[k]);
+    }
+}
+
+TEST_CASE("simplex_distribution", "[distributions]")
+{
+    using namespace crand;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("single coordinate")
+    {
+        CALL(check_simplex, simplex_distribution<double, 1>{}, runs);
+    }
+    SECTION("segment")
+    {
+        CALL(check_simplex, simplex_distribution<double, 2>{}, runs);
+    }
+    SECTION("triangle")
+    {
+        CALL(check_simplex, simplex_distribution<double, 3>{}, runs);
+    }
+    SECTION("higher dimensions")
+    {
+        CALL(check_simplex, simplex_distribution<double, 7>{}, runs);
+    }
+}
+EVAL_TEST_CASE("simplex_distribution");
@@ -0,0 +1,143 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/static_discrete_distribution.hpp"
+#include "crand/engines/xorshift_engine.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace
+{
+/// Engine with 8 bit words that returns a fixed value, so all words can be enumerated.
+struct fixed_byte_engine
+{
+    using result_type = std::uint8_t;
+
+    constexpr auto operator()() const noexcept -> result_type { return value; }
+
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    static constexpr auto max() noexcept -> result_type { return 255; }
+
+    std::uint8_t value;
+};
+} // namespace
+
+TEST_CASE("static_discrete_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("satisfies random_number_distribution")
+    {
+        REQUIRE(random_number_distribution<static_discrete_distribution<1, 2, 3>>);
+    }
+    SECTION("min, max and probabilities")
+    {
+        using D = static_discrete_distribution<1, 0, 3, 0>;
+        REQUIRE(D::min() == 0);
+        REQUIRE(D::max() == 2);
+        REQUIRE(D::probabilities() == std::array{0.25, 0., 0.75, 0.});
+    }
+    SECTION("every index covers the same number of words per unit of weight")
+    {
+        // 255 / 6 = 42 words per unit of weight, the words 252 to 255 are rejected.
+        static_discrete_distribution<1, 2, 0, 3> d;
+        std::array<int, 4>                       counts{};
+        for (int x = 0; x < 252; ++x)
+        {
+            fixed_byte_engine g{static_cast<std::uint8_t>(x)};
+            ++counts[d(g)];
+        }
+        REQUIRE(counts == std::array{42, 84, 0, 126});
+    }
+    SECTION("power of two totals cover all words")
+    {
+        static_discrete_distribution<64, 128, 64> d;
+        std::array<int, 3>                        counts{};
+        for (int x = 0; x < 256; ++x)
+        {
+            fixed_byte_engine g{static_cast<std::uint8_t>(x)};
+            ++counts[d(g)];
+        }
+        REQUIRE(counts == std::array{64, 128, 64});
+    }
+    SECTION("a single outcome")
+    {
+        static_discrete_distribution<0, 1> d;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(e) == 1);
+    }
+    SECTION("zero weights are never drawn")
+    {
+        static_discrete_distribution<0, 5, 0, 5, 0> d;
+        for (int i = 0; i < runs; ++i)
+        {
+            auto const n = d(e);
+            REQUIRE((n == 1 || n == 3));
+        }
+    }
+    SECTION("frequencies follow the weights")
+    {
+        static_discrete_distribution<1, 2, 7> d;
+        xorshift32                            xe;
+        std::array<int, 3>                    counts{};
+        for (int i = 0; i < runs; ++i)
+            ++counts[d(xe)];
+        REQUIRE(counts[0] > runs * 0.05);
+        REQUIRE(counts[0] < runs * 0.15);
+        REQUIRE(counts[1] > runs * 0.15);
+        REQUIRE(counts[1] < runs * 0.25);
+        REQUIRE(counts[2] > runs * 0.65);
+        REQUIRE(counts[2] < runs * 0.75);
+    }
+    SECTION("many outcomes use a binary search")
+    {
+        static_discrete_distribution<1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 2>
+                           d;
+        std::array<int, 2> tail{};
+        for (int i = 0; i < runs; ++i)
+        {
+            auto const n = d(e);
+            REQUIRE(n != 69);
+            REQUIRE(n <= 70);
+            if (n >= 68)
+                ++tail[n == 70 ? 1 : 0];
+        }
+        REQUIRE(tail[1] > tail[0]);
+    }
+}
+EVAL_TEST_CASE("static_discrete_distribution");
@@ -0,0 +1,162 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/static_uniform_int_distribution.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/bit_buffer.hpp"
+#include "crand/engines/xorshift_engine.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <initializer_list>
+#include <limits>
+#include <span>
+
+namespace
+{
+// Checks that `generate` produces the same values as repeated `operator()` and consumes the same engine output, for
+// lengths around the batch size
+ASSERTING_FUNCTION(check_generate, (auto d, auto g))
+{
+    std::array<typename decltype(d)::result_type, 200> out{};
+    for (std::size_t const n : {std::size_t{0}, std::size_t{1}, std::size_t{63}, std::size_t{64}, out.size()})
+    {
+        auto copy = g;
+        d.generate(g, std::span{out}.first(n));
+        for (std::size_t i = 0; i < n; ++i)
+            REQUIRE(out[i] == d(copy));
+        REQUIRE(g == copy);
+    }
+}
+} // namespace
+
+TEST_CASE("static_uniform_int_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("satisfies random_number_distribution")
+    {
+        REQUIRE(random_number_distribution<static_uniform_int_distribution<int, 1, 6>>);
+        REQUIRE(batch_random_number_distribution<static_uniform_int_distribution<int, 1, 6>>);
+    }
+    SECTION("generate must be same as repeated operator()")
+    {
+        using T = xoshiro256_starstar::result_type;
+        CALL(check_generate, static_uniform_int_distribution<int, 1, 6>{}, e);
+        CALL(check_generate, static_uniform_int_distribution<int, -4, 3>{}, e);
+        CALL(check_generate, static_uniform_int_distribution<int, 3, 3>{}, e);
+        CALL(check_generate, static_uniform_int_distribution<T, 0, std::numeric_limits<T>::max()>{}, e);
+        CALL(check_generate,
+             static_uniform_int_distribution<std::uint64_t, 0, std::uint64_t{1} << 40u>{},
+             xorshift32{});
+        CALL(check_generate, static_uniform_int_distribution<unsigned, 0, 9>{}, bit_buffer<xoshiro256_starstar>{});
+    }
+    SECTION("distribution with same range as engine should produce same results")
+    {
+        using T = xoshiro256_starstar::result_type;
+        static_uniform_int_distribution<T, 0, std::numeric_limits<T>::max()> d;
+        auto                                                                 engine_copy = e;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(engine_copy) == e());
+    }
+    SECTION("distribution with 1 element should always produce that element")
+    {
+        static_uniform_int_distribution<int, 3, 3> d;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(e) == 3);
+    }
+    SECTION("power of two ranges take the top bits of a single word")
+    {
+        static_uniform_int_distribution<int, -4, 3> d;
+        auto                                        engine_copy = e;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(engine_copy) == static_cast<int>(e() >> 61u) - 4);
+    }
+    SECTION("produces the same values as uniform_int_distribution")
+    {
+        static_uniform_int_distribution<int, -8, 2> d;
+        uniform_int_distribution<int>               dynamic{inclusive{-8}, inclusive{2}};
+        auto                                        engine_copy = e;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(e) == dynamic(engine_copy));
+    }
+    SECTION("consumes the same random bits as uniform_int_distribution for a single element")
+    {
+        static_uniform_int_distribution<int, 3, 3> d;
+        uniform_int_distribution<int>              dynamic{inclusive{3}, inclusive{3}};
+        uniform_int_distribution<int>              next{inclusive{1}, inclusive{6}};
+        auto                                       engine_copy = e;
+        bit_buffer<xoshiro256_starstar>            b1;
+        bit_buffer<xoshiro256_starstar>            b2;
+        for (int i = 0; i < runs; ++i)
+        {
+            REQUIRE(d(e) == dynamic(engine_copy));
+            REQUIRE(next(e) == next(engine_copy));
+            REQUIRE(d(b1) == dynamic(b2));
+            REQUIRE(next(b1) == next(b2));
+        }
+    }
+    SECTION("produces the same values as uniform_int_distribution with a bit_buffer")
+    {
+        static_uniform_int_distribution<unsigned, 0, 9> d;
+        uniform_int_distribution<unsigned>              dynamic{inclusive{0u}, inclusive{9u}};
+        bit_buffer<xoshiro256_starstar>                 b1;
+        bit_buffer<xoshiro256_starstar>                 b2;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(b1) == dynamic(b2));
+    }
+    SECTION("all values are generated with similar frequency")
+    {
+        static_uniform_int_distribution<int, 1, 6> d;
+        std::array<int, 6>                          counts{};
+        for (int i = 0; i < runs; ++i)
+        {
+            auto const c = d(e);
+            REQUIRE(c >= d.min());
+            REQUIRE(c <= d.max());
+            ++counts[c - 1];
+        }
+        for (int c : counts)
+            REQUIRE(c > runs / 6 * 0.85);
+    }
+    SECTION("Works with engine that generates fewer bits than required")
+    {
+        xorshift32                                           xe;
+        constexpr std::uint64_t                              b = std::uint64_t{1} << 40u;
+        static_uniform_int_distribution<std::uint64_t, 0, b> d;
+        for (int i = 0; i < runs; ++i)
+            REQUIRE(d(xe) <= b);
+    }
+}
+EVAL_TEST_CASE("static_uniform_int_distribution");
@@ -0,0 +1,156 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/concepts/random_number_distribution.hpp"
+#include "crand/distributions/truncated_normal_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <limits>
+
+namespace
+{
+template<typename D, typename G>
+constexpr auto sample_mean(D& d, G& g, int runs) -> double
+{
+    double sum = 0;
+    for (int i = 0; i < runs; ++i)
+        sum += d(g);
+    return sum / runs;
+}
+
+template<typename D, typename G>
+constexpr auto all_within_bounds(D& d, G& g, int runs) -> bool
+{
+    for (int i = 0; i < runs; ++i)
+    {
+        auto const x = d(g);
+        if (x < d.a() || x > d.b())
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+TEST_CASE("truncated_normal_distribution", "[distributions]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+    constexpr auto      inf = std::numeric_limits<double>::infinity();
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("satisfies random_number_distribution")
+    {
+        REQUIRE(random_number_distribution<truncated_normal_distribution<>>);
+    }
+    SECTION("interval around the mean")
+    {
+        // Expected mean: (phi(-1) - phi(2)) / (Phi(2) - Phi(-1)) = 0.2296
+        truncated_normal_distribution d{0., 1., -1., 2.};
+        REQUIRE(all_within_bounds(d, e, runs));
+        auto const mean = sample_mean(d, e, runs);
+        REQUIRE(mean > 0.18);
+        REQUIRE(mean < 0.28);
+    }
+    SECTION("wide interval around the mean")
+    {
+        truncated_normal_distribution d{3., 2., -7., 13.};
+        REQUIRE(all_within_bounds(d, e, runs));
+        auto const mean = sample_mean(d, e, runs);
+        REQUIRE(mean > 2.8);
+        REQUIRE(mean < 3.2);
+    }
+    SECTION("unbounded")
+    {
+        truncated_normal_distribution d{0., 1., -inf, inf};
+        auto const                    mean = sample_mean(d, e, runs);
+        REQUIRE(mean > -0.1);
+        REQUIRE(mean < 0.1);
+    }
+    SECTION("upper tail")
+    {
+        // Expected mean: phi(0.5) / (1 - Phi(0.5)) = 1.1411
+        truncated_normal_distribution d{0., 1., 0.5, inf};
+        REQUIRE(all_within_bounds(d, e, runs));
+        auto const mean = sample_mean(d, e, runs);
+        REQUIRE(mean > 1.09);
+        REQUIRE(mean < 1.19);
+    }
+    SECTION("far tails, where rejecting normal samples would practically never terminate")
+    {
+        // Expected mean: phi(10) / (1 - Phi(10)) = 10.0981
+        truncated_normal_distribution upper{0., 1., 10., inf};
+        REQUIRE(all_within_bounds(upper, e, runs));
+        auto const upper_mean = sample_mean(upper, e, runs);
+        REQUIRE(upper_mean > 10.08);
+        REQUIRE(upper_mean < 10.12);
+
+        truncated_normal_distribution lower{5., 2., -inf, -15.};
+        REQUIRE(all_within_bounds(lower, e, runs));
+        auto const lower_mean = sample_mean(lower, e, runs);
+        REQUIRE(lower_mean > -15.24);
+        REQUIRE(lower_mean < -15.16);
+    }
+    SECTION("narrow intervals")
+    {
+        truncated_normal_distribution center{0., 1., 1., 1.01};
+        REQUIRE(all_within_bounds(center, e, runs));
+
+        truncated_normal_distribution tail{0., 1., 6., 6.1};
+        REQUIRE(all_within_bounds(tail, e, runs));
+        // The density falls steeply, so most values are close to the lower bound
+        REQUIRE(sample_mean(tail, e, runs) < 6.05);
+    }
+    SECTION("half-normal shape")
+    {
+        // Expected mean: 3 + 2 * sqrt(2 / pi) = 4.5958
+        truncated_normal_distribution d{3., 2., 3., inf};
+        REQUIRE(all_within_bounds(d, e, runs));
+        auto const mean = sample_mean(d, e, runs);
+        REQUIRE(mean > 4.45);
+        REQUIRE(mean < 4.75);
+    }
+    SECTION("param_type")
+    {
+        using param_type = truncated_normal_distribution<double>::param_type;
+
+        truncated_normal_distribution d{0., 1., -1., 1.};
+        for (param_type const& p : {param_type{0., 1., -0.1, 0.2}, param_type{2., 3., 10., inf}})
+        {
+            truncated_normal_distribution reference{p.mean(), p.stddev(), p.a(), p.b()};
+            auto                          e2 = e;
+            for (int i = 0; i < 100; ++i)
+                REQUIRE(d(e, p) == reference(e2));
+        }
+
+        d.param(param_type{0., 1., 2., 3.});
+        REQUIRE(d == truncated_normal_distribution{0., 1., 2., 3.});
+    }
+}
+EVAL_TEST_CASE("truncated_normal_distribution");
@@ -102,6 +102,82 @@ TEST_CASE("uniform_int_distribution", "[distributions]")
                 REQUIRE(c <= b);
             }
         }
+        SECTION("Assembles values from exactly as many words as required")
+        {
+            xorshift32                              xe;
+            auto                                    engine_copy = xe;
+            std::uint64_t const                     b           = (std::uint64_t{1} << 40u) - 1;
+            uniform_int_distribution<std::uint64_t> d(inclusive<std::uint64_t>{0}, inclusive{b});
+            for (int i = 0; i < runs; ++i)
+            {
+                auto const high = std::uint64_t{engine_copy() >> 24u};
+                auto const low  = std::uint64_t{engine_copy()};
+                REQUIRE(d(xe) == ((high << 32u) | low));
+            }
+        }
+        SECTION("Full 64 bit range from a 32 bit engine")
+        {
+            xorshift32                              xe;
+            auto                                    engine_copy = xe;
+            uniform_int_distribution<std::uint64_t> d(inclusive<std::uint64_t>{0},
+                                                      inclusive{std::numeric_limits<std::uint64_t>::max()});
+            for (int i = 0; i < runs; ++i)
+            {
+                auto const high = std::uint64_t{engine_copy()};
+                auto const low  = std::uint64_t{engine_copy()};
+                REQUIRE(d(xe) == ((high << 32u) | low));
+            }
+        }
+#if defined(__SIZEOF_INT128__)
+        SECTION("128 bit integers")
+        {
+            __extension__ using uint128 = unsigned __int128;
+            __extension__ using int128  = __int128;
+
+            SECTION("full range from a 64 bit engine")
+            {
+                auto                              engine_copy = e;
+                uniform_int_distribution<uint128> d(inclusive<uint128>{0}, inclusive{~uint128{0}});
+                for (int i = 0; i < runs; ++i)
+                {
+                    auto const high = uint128{engine_copy()};
+                    auto const low  = uint128{engine_copy()};
+                    REQUIRE(d(e) == ((high << 64u) | low));
+                }
+            }
+            SECTION("full range from a 32 bit engine")
+            {
+                xorshift32                        xe;
+                auto                              engine_copy = xe;
+                uniform_int_distribution<uint128> d(inclusive<uint128>{0}, inclusive{~uint128{0}});
+                for (int i = 0; i < runs; ++i)
+                {
+                    uint128 expected = 0;
+                    for (int w = 0; w < 4; ++w)
+                        expected = (expected << 32u) | engine_copy();
+                    REQUIRE(d(xe) == expected);
+                }
+            }
+            SECTION("signed ranges")
+            {
+                int128 const                     a = -(int128{1} << 100u);
+                int128 const                     b = int128{1} << 99u;
+                uniform_int_distribution<int128> d(inclusive{a}, inclusive{b});
+                bool                             negative = false;
+                bool                             positive = false;
+                for (int i = 0; i < runs; ++i)
+                {
+                    auto const c = d(e);
+                    REQUIRE(c >= a);
+                    REQUIRE(c <= b);
+                    negative = negative || c < 0;
+                    positive = positive || c > 0;
+                }
+                REQUIRE(negative);
+                REQUIRE(positive);
+            }
+        }
+#endif
     }
     SECTION("exclusive - inclusive")
     {
@@ -145,5 +221,24 @@ TEST_CASE("uniform_int_distribution", "[distributions]")
             REQUIRE(c < b);
         }
     }
+
+    SECTION("param_type")
+    {
+        using param_type = uniform_int_distribution<int>::param_type;
+
+        uniform_int_distribution d(inclusive{0}, inclusive{10});
+        param_type const         p(exclusive{-100}, exclusive{100});
+        uniform_int_distribution reference(exclusive{-100}, exclusive{100});
+        REQUIRE(p.min() == -99);
+        REQUIRE(p.max() == 99);
+
+        auto e2 = e;
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(d(e, p) == reference(e2));
+
+        d.param(p);
+        REQUIRE(d == reference);
+        REQUIRE(d.param() == p);
+    }
 }
 EVAL_TEST_CASE("uniform_int_distribution");
\ No newline at end of file
@@ -27,6 +27,13 @@
 
 #include <bugspray/bugspray.hpp>
 
+#include <array>
+#include <cstdint>
+#include <limits>
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
 TEST_CASE("uniform_real_distribution", "[distributions]")
 {
     using namespace crand;
@@ -209,5 +216,153 @@ TEST_CASE("uniform_real_distribution", "[distributions]")
             }
         }
     }
+
+    SECTION("generate_packed")
+    {
+        SECTION("two float values per word")
+        {
+            // [0, 1) holds 2^24 floats, so no candidate is rejected and each word yields two values from its halves
+            uniform_real_distribution const d(inclusive{0.f}, exclusive{1.f});
+            auto const value = [](std::uint32_t lane)
+            {
+                auto const k = 1 + (lane >> 8);
+                return k == (1u << 24) ? 0.f : 1.f - static_cast<float>(k) * 0x1p-24f;
+            };
+
+            std::array<float, 100> packed{};
+            auto                   e2 = e;
+            d.generate_packed(e, packed);
+            for (std::size_t i = 0; i < packed.size(); i += 2)
+            {
+                auto const w = e2();
+                REQUIRE(packed[i] == value(static_cast<std::uint32_t>(w >> 32)));
+                REQUIRE(packed[i + 1] == value(static_cast<std::uint32_t>(w)));
+            }
+            REQUIRE(e == e2);
+
+            // The second half of the last word is discarded
+            std::array<float, 7> odd{};
+            d.generate_packed(e, odd);
+            for (int i = 0; i < 4; ++i)
+                e2();
+            REQUIRE(e == e2);
+        }
+
+        SECTION("rejection")
+        {
+            uniform_real_distribution const d(inclusive{-1.f}, inclusive{1.f});
+            std::array<float, 1000>         packed{};
+            d.generate_packed(e, packed);
+            for (auto const x : packed)
+            {
+                REQUIRE(x >= d.min());
+                REQUIRE(x <= d.max());
+            }
+        }
+
+        SECTION("double equals generate")
+        {
+            uniform_real_distribution const d(exclusive{-2.}, inclusive{3.});
+            std::array<double, 100>         packed{};
+            std::array<double, 100>         plain{};
+            auto                            e2 = e;
+            d.generate_packed(e, packed);
+            d.generate(e2, plain);
+            REQUIRE(packed == plain);
+        }
+
+#if defined(__STDCPP_FLOAT16_T__)
+        SECTION("four std::float16_t values per word")
+        {
+            uniform_real_distribution const d(inclusive{std::float16_t{0}}, exclusive{std::float16_t{1}});
+            std::array<std::float16_t, 8>   packed{};
+            auto                            e2 = e;
+            d.generate_packed(e, packed);
+            for (auto const x : packed)
+            {
+                REQUIRE(x >= d.min());
+                REQUIRE(x <= d.max());
+            }
+            e2();
+            e2();
+            REQUIRE(e == e2);
+        }
+#endif
+    }
+
+    SECTION("gamma and number of values")
+    {
+        uniform_real_distribution const d1(inclusive{1.}, inclusive{2.});
+        REQUIRE(d1.gamma() == 0x1p-52);
+        REQUIRE(d1.num_unique_values() == std::size_t{1} << 52);
+
+        uniform_real_distribution const d2(inclusive{-1.f}, inclusive{.5f});
+        REQUIRE(d2.gamma() == 0x1p-24f);
+        REQUIRE(d2.num_unique_values() == 25165824);
+
+        uniform_real_distribution const d3(inclusive{0.}, inclusive{std::numeric_limits<double>::denorm_min()});
+        REQUIRE(d3.gamma() == std::numeric_limits<double>::denorm_min());
+        REQUIRE(d3.num_unique_values() == 1);
+
+        uniform_real_distribution const d4(inclusive{42.}, inclusive{42.});
+        REQUIRE(d4.gamma() == 0.);
+
+        // The number of values exceeds the precision of the type, and is still exact
+        uniform_real_distribution const d5(inclusive{-4.}, inclusive{4 * std::numeric_limits<double>::denorm_min()});
+        REQUIRE(d5.gamma() == 0x1p-51);
+        REQUIRE(d5.num_unique_values() == (std::size_t{1} << 53) + 1);
+
+        uniform_real_distribution const d6(inclusive{-0x1.704ea8p+26f}, inclusive{0x1p-148f});
+        REQUIRE(d6.gamma() == 8.f);
+        REQUIRE(d6.num_unique_values() == 12068693);
+    }
+
+    SECTION("param_type")
+    {
+        using param_type = uniform_real_distribution<double>::param_type;
+
+        uniform_real_distribution d(inclusive{0.}, inclusive{1.});
+        param_type const          p(inclusive{2.}, exclusive{4.});
+        uniform_real_distribution reference(inclusive{2.}, exclusive{4.});
+        REQUIRE(p.min() == reference.min());
+        REQUIRE(p.max() == reference.max());
+        REQUIRE(p.gamma() == reference.gamma());
+
+        auto e2 = e;
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(d(e, p) == reference(e2));
+
+        d.param(p);
+        REQUIRE(d == reference);
+        REQUIRE(d.param() == p);
+    }
+
+    SECTION("param_type::rebind")
+    {
+        using param_type = uniform_real_distribution<double>::param_type;
+
+        // Shifted within the same binade, the derived data is reused
+        param_type const p(inclusive{1.}, exclusive{1.5});
+        REQUIRE(p.rebind(inclusive{1.25}, exclusive{1.75}) == param_type(inclusive{1.25}, exclusive{1.75}));
+        REQUIRE(p.rebind(inclusive{1.5}, exclusive{2.}) == param_type(inclusive{1.5}, exclusive{2.}));
+        param_type const q(inclusive{-3.}, inclusive{-2.5});
+        REQUIRE(q.rebind(inclusive{-3.5}, inclusive{-3.}) == param_type(inclusive{-3.5}, inclusive{-3.}));
+        param_type const r(exclusive{0.5}, exclusive{0.75});
+        REQUIRE(r.rebind(exclusive{0.625}, exclusive{0.875}) == param_type(exclusive{0.625}, exclusive{0.875}));
+
+        // Otherwise, everything is recomputed
+        REQUIRE(p.rebind(inclusive{1.5}, exclusive{2.5}) == param_type(inclusive{1.5}, exclusive{2.5}));
+        REQUIRE(p.rebind(inclusive{0.5}, exclusive{1.}) == param_type(inclusive{0.5}, exclusive{1.}));
+        REQUIRE(p.rebind(inclusive{1.}, exclusive{3.}) == param_type(inclusive{1.}, exclusive{3.}));
+        REQUIRE(p.rebind(inclusive{-2.}, exclusive{-1.5}) == param_type(inclusive{-2.}, exclusive{-1.5}));
+        REQUIRE(p.rebind(exclusive{1.25}, inclusive{1.75}) == param_type(exclusive{1.25}, inclusive{1.75}));
+        REQUIRE(p.rebind(inclusive{1.1}, exclusive{1.6}) == param_type(inclusive{1.1}, exclusive{1.6}));
+
+        // A shift that is exact for the bound of larger magnitude only
+        using float_param_type = uniform_real_distribution<float>::param_type;
+        float_param_type const f(exclusive{0x1.2aa16cp-4f}, inclusive{0x1.0eb366p-1f});
+        REQUIRE(f.rebind(exclusive{0x1.8aa85cp-2f}, inclusive{0x1.aeb366p-1f})
+                == float_param_type(exclusive{0x1.8aa85cp-2f}, inclusive{0x1.aeb366p-1f}));
+    }
 }
 EVAL_TEST_CASE("uniform_real_distribution");
\ No newline at end of file
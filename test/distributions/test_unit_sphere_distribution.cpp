@@ -0,0 +1,112 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/unit_sphere_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <cmath>
+
+ASSERTING_FUNCTION(check_unit_sphere, (auto d, int runs))
+{
+    constexpr std::size_t      dims = std::tuple_size_v<typename decltype(d)::result_type>;
+    crand::xoshiro256_starstar e;
+
+    std::array<double, dims> mean{};
+    std::array<double, dims> squares{};
+    for (int i = 0; i < runs; ++i)
+    {
+        auto const p    = d(e);
+        double     norm = 0;
+        for (std::size_t k = 0; k < dims; ++k)
+        {
+            norm += p[k] * p[k];
+            mean[k] += p[k] / runs;
+            squares[k] += p[k] * p[k] / runs;
+        }
+        REQUIRE(std::abs(norm - 1) < 1e-12);
+    }
+    for (std::size_t k = 0; k < dims; ++k)
+    {
+        REQUIRE(std::abs(mean[k]) < 0.1);
+        REQUIRE(std::abs(squares[k] - 1. / dims) < 0.05);
+    }
+
+    // More columns than fit into one block
+    constexpr std::size_t points = 300;
+    std::vector<double>   out(dims * points);
+    d.generate(e, std::span{out});
+    for (std::size_t j = 0; j < points; ++j)
+    {
+        double norm = 0;
+        for (std::size_t k = 0; k < dims; ++k)
+            norm += out[k * points + j] * out[k * points + j];
+        REQUIRE(std::abs(norm - 1) < 1e-12);
+    }
+}
+
+TEST_CASE("unit_sphere_distribution", "[distributions]")
+{
+    using namespace crand;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("circle")
+    {
+        CALL(check_unit_sphere, unit_sphere_distribution<double, 2>{}, runs);
+    }
+    SECTION("sphere")
+    {
+        CALL(check_unit_sphere, unit_sphere_distribution<double, 3>{}, runs);
+    }
+    SECTION("higher dimensions")
+    {
+        CALL(check_unit_sphere, unit_sphere_distribution<double, 1>{}, runs);
+        CALL(check_unit_sphere, unit_sphere_distribution<double, 5>{}, runs);
+    }
+    SECTION("generate produces the same points as operator() for D = 3")
+    {
+        unit_sphere_distribution<double, 3> d;
+        xoshiro256_starstar                 e;
+        auto                                engine_copy = e;
+
+        std::array<double, 3 * 10> out{};
+        d.generate(e, std::span{out});
+        for (std::size_t j = 0; j < 10; ++j)
+        {
+            auto const p = d(engine_copy);
+            for (std::size_t k = 0; k < 3; ++k)
+                REQUIRE(out[k * 10 + j] == p[k]);
+        }
+    }
+}
+EVAL_TEST_CASE("unit_sphere_distribution");
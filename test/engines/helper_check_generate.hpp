@@ -0,0 +1,72 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HELPER_CHECK_GENERATE_HPP
+#define CONSTEXPR_RANDOM_HELPER_CHECK_GENERATE_HPP
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/detail/cpu_dispatch.hpp>
+#include <crand/engines/generate.hpp>
+
+#include <array>
+#include <initializer_list>
+#include <span>
+
+// Checks that `generate` produces the same values as repeated `operator()` and leaves the engine in the same state, for
+// lengths around the block size of the kernels. At runtime, the kernel of every supported instruction set is checked.
+ASSERTING_FUNCTION(helper_check_generate, (std::uniform_random_bit_generator auto gen))
+{
+    namespace cd = crand::detail::cpu_dispatch;
+    constexpr std::size_t b = cd::block_size;
+
+    int isas = 1;
+    if !consteval
+    {
+        isas = static_cast<int>(cd::detect()) + 1;
+    }
+    for (int isa = 0; isa < isas; ++isa)
+    {
+        CAPTURE(isa);
+        if !consteval
+        {
+            cd::selected = static_cast<cd::isa>(isa);
+        }
+        std::array<typename decltype(gen)::result_type, 3 * b + 5> out{};
+        for (std::size_t const n : {std::size_t{0}, std::size_t{1}, b - 1, b, b + 1, out.size()})
+        {
+            CAPTURE(n);
+            auto copy = gen;
+            crand::generate(gen, std::span{out}.first(n));
+            for (std::size_t i = 0; i < n; ++i)
+                REQUIRE(out[i] == copy());
+            REQUIRE(gen == copy);
+        }
+    }
+    if !consteval
+    {
+        cd::selected = cd::detect();
+    }
+}
+
+#endif // CONSTEXPR_RANDOM_HELPER_CHECK_GENERATE_HPP
@@ -0,0 +1,165 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HELPER_STATISTICAL_BATTERY_HPP
+#define CONSTEXPR_RANDOM_HELPER_STATISTICAL_BATTERY_HPP
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <climits>
+#include <cmath>
+#include <cstdint>
+
+// A small battery of statistical tests, in the spirit of DIEHARD. Every test returns a z-score, i.e. a value that is
+// approximately standard normal distributed for a good generator. Each test inspects 32 bits of every generated number,
+// starting at bit `shift`.
+
+/// Converts a chi-square distributed value with `df` degrees of freedom to a z-score (Wilson-Hilferty).
+constexpr auto chi_square_to_z(double chi_square, double df) -> double
+{
+    double const v = 2. / (9. * df);
+    return (std::pow(chi_square / df, 1. / 3.) - (1. - v)) / std::sqrt(v);
+}
+
+/// Birthday spacings test: 4096 birthdays in a year of 2^32 days; the number of duplicate spacings is Poisson
+/// distributed with lambda = 4.
+template<std::uniform_random_bit_generator G>
+constexpr auto birthday_spacings_test(G& gen, unsigned shift) -> double
+{
+    constexpr std::size_t m      = 4096;
+    constexpr std::size_t reps   = 250;
+    constexpr double      lambda = 4.;
+
+    std::vector<std::uint32_t> days(m);
+    std::size_t                duplicates = 0;
+    for (std::size_t r = 0; r < reps; ++r)
+    {
+        for (auto& d : days)
+            d = static_cast<std::uint32_t>(gen() >> shift);
+        std::ranges::sort(days);
+        std::adjacent_difference(days.begin(), days.end(), days.begin());
+        std::ranges::sort(days);
+        for (std::size_t i = 1; i < m; ++i)
+            duplicates += (days[i] == days[i - 1]);
+    }
+    double const expected = lambda * reps;
+    return (static_cast<double>(duplicates) - expected) / std::sqrt(expected);
+}
+
+/// Gap test: the length of gaps between numbers falling into [0, 1/8) is geometrically distributed.
+template<std::uniform_random_bit_generator G>
+constexpr auto gap_test(G& gen, unsigned shift) -> double
+{
+    constexpr std::size_t gaps       = 100000;
+    constexpr std::size_t categories = 24; // Gap lengths 0..22, and >= 23
+    constexpr double      p          = 1. / 8.;
+
+    std::array<std::size_t, categories> counts{};
+    for (std::size_t i = 0; i < gaps; ++i)
+    {
+        std::size_t length = 0;
+        while (static_cast<std::uint32_t>(gen() >> shift) >= (std::uint32_t{1} << 29u))
+            ++length;
+        ++counts[std::min(length, categories - 1)];
+    }
+
+    double chi_square  = 0;
+    double probability = p;
+    for (std::size_t i = 0; i < categories; ++i)
+    {
+        if (i == categories - 1)
+            probability = std::pow(1. - p, static_cast<double>(categories - 1));
+        double const expected = probability * gaps;
+        double const diff     = static_cast<double>(counts[i]) - expected;
+        chi_square += diff * diff / expected;
+        probability *= (1. - p);
+    }
+    return chi_square_to_z(chi_square, categories - 1);
+}
+
+/// Binary matrix rank test: the rank over GF(2) of 32x32 bit matrices, built from 32 consecutive numbers.
+template<std::uniform_random_bit_generator G>
+constexpr auto matrix_rank_test(G& gen, unsigned shift) -> double
+{
+    constexpr std::size_t           matrices = 20000;
+    constexpr std::array<double, 3> p{0.2887880950866, 0.5775761901732, 0.1336357147402}; // Rank 32, 31, <= 30
+
+    std::array<std::size_t, 3> counts{};
+    for (std::size_t i = 0; i < matrices; ++i)
+    {
+        std::array<std::uint32_t, 32> rows{};
+        for (auto& r : rows)
+            r = static_cast<std::uint32_t>(gen() >> shift);
+
+        std::size_t rank = 0;
+        for (unsigned bit = 0; bit < 32 && rank < rows.size(); ++bit)
+        {
+            std::uint32_t const mask  = std::uint32_t{1} << bit;
+            auto const          pivot = std::find_if(rows.begin() + rank, rows.end(), [&](auto r) { return r & mask; });
+            if (pivot == rows.end())
+                continue;
+            std::iter_swap(rows.begin() + rank, pivot);
+            for (std::size_t j = rank + 1; j < rows.size(); ++j)
+                if (rows[j] & mask)
+                    rows[j] ^= rows[rank];
+            ++rank;
+        }
+        ++counts[std::min<std::size_t>(32 - rank, 2)];
+    }
+
+    double chi_square = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        double const expected = p[i] * matrices;
+        double const diff     = static_cast<double>(counts[i]) - expected;
+        chi_square += diff * diff / expected;
+    }
+    return chi_square_to_z(chi_square, counts.size() - 1);
+}
+
+/// Runs all tests of the battery on the upper 32 bits, and for wider generators also on the lower 32 bits.
+ASSERTING_FUNCTION(helper_check_statistical_battery, (std::uniform_random_bit_generator auto& gen))
+{
+    constexpr double max_z = 4.; // The battery is deterministic, but this keeps false positives unlikely
+    constexpr auto   bits  = sizeof(gen()) * CHAR_BIT;
+
+    std::vector<unsigned> shifts{bits - 32};
+    if (bits > 32)
+        shifts.push_back(0);
+    for (auto const shift : shifts)
+    {
+        CAPTURE(shift);
+        REQUIRE(std::abs(birthday_spacings_test(gen, shift)) < max_z);
+        REQUIRE(std::abs(gap_test(gen, shift)) < max_z);
+        REQUIRE(std::abs(matrix_rank_test(gen, shift)) < max_z);
+    }
+}
+
+#endif // CONSTEXPR_RANDOM_HELPER_STATISTICAL_BATTERY_HPP
@@ -0,0 +1,158 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <bugspray/bugspray.hpp>
+#include <crand/concepts/random_bit_source.hpp>
+#include <crand/concepts/uniform_random_bit_generator.hpp>
+#include <crand/distributions/bernoulli_distribution.hpp>
+#include <crand/distributions/uniform_int_distribution.hpp>
+#include <crand/engines/bit_buffer.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+// Counts the invocations of the wrapped engine
+template<typename G>
+struct counting_engine
+{
+    using result_type = typename G::result_type;
+
+    constexpr auto operator()() -> result_type
+    {
+        ++calls;
+        return engine();
+    }
+    static constexpr auto min() -> result_type { return G::min(); }
+    static constexpr auto max() -> result_type { return G::max(); }
+
+    G           engine;
+    std::size_t calls = 0;
+};
+} // namespace
+
+TEST_CASE("bit_buffer", "[engines]")
+{
+    using namespace crand;
+
+    int runs;
+    if (std::is_constant_evaluated())
+        runs = 1000;
+    else
+        runs = 100000;
+
+    SECTION("satisfies random_bit_source")
+    {
+        REQUIRE(uniform_random_bit_generator<bit_buffer<xoshiro256_starstar>>);
+        REQUIRE(random_bit_source<bit_buffer<xoshiro256_starstar>>);
+        REQUIRE(random_bit_source<bit_buffer<xorshift32>>);
+        REQUIRE(!random_bit_source<xoshiro256_starstar>);
+    }
+    SECTION("operator() forwards to the engine")
+    {
+        xoshiro256_starstar             e;
+        bit_buffer<xoshiro256_starstar> b;
+        for (int i = 0; i < 100; ++i)
+            REQUIRE(b() == e());
+    }
+    SECTION("bits are handed out most significant first")
+    {
+        xoshiro256_starstar             e;
+        bit_buffer<xoshiro256_starstar> b;
+        for (int i = 0; i < 100; ++i)
+        {
+            auto const word = e();
+            for (int byte = 7; byte >= 0; --byte)
+                REQUIRE(b.bits<8>() == ((word >> (8 * byte)) & 0xff));
+        }
+        REQUIRE(b.bits<64>() == e());
+        REQUIRE(b.bits(1) == e() >> 63u);
+    }
+    SECTION("remaining bits are discarded if too few for a request")
+    {
+        xorshift32             e;
+        bit_buffer<xorshift32> b;
+        auto const first  = e();
+        auto const second = e();
+        REQUIRE(b.bits<20>() == first >> 12u);
+        REQUIRE(b.bits<20>() == second >> 12u);
+        REQUIRE(b.bits<12>() == second % (1u << 12u));
+        REQUIRE(b.bits<1>() == e() >> 31u);
+    }
+    SECTION("uniform_int_distribution consumes only the bits it needs")
+    {
+        bit_buffer<counting_engine<xoshiro256_starstar>> b;
+        uniform_int_distribution                         d{inclusive{0}, inclusive{3}};
+        std::array<int, 4>                               counts{};
+        for (int i = 0; i < runs; ++i)
+            ++counts[d(b)];
+        REQUIRE(b.base().calls == static_cast<std::size_t>(runs + 31) / 32);
+        for (int c : counts)
+            REQUIRE(c > runs / 4 * 0.9);
+    }
+    SECTION("uniform_int_distribution falls back to full words for large ranges")
+    {
+        bit_buffer<xorshift32>                  b;
+        uniform_int_distribution<std::uint64_t> d{inclusive<std::uint64_t>{0}, inclusive<std::uint64_t>{1ull << 40u}};
+        for (int i = 0; i < runs / 10; ++i)
+            REQUIRE(d(b) <= (1ull << 40u));
+    }
+    SECTION("bernoulli_distribution consumes 16 bits per sample")
+    {
+        bit_buffer<counting_engine<xoshiro256_starstar>> b;
+        bernoulli_distribution                           d{0.3};
+        int                                              trues = 0;
+        for (int i = 0; i < runs; ++i)
+            trues += d(b);
+        REQUIRE(b.base().calls >= static_cast<std::size_t>(runs) / 4);
+        REQUIRE(b.base().calls <= static_cast<std::size_t>(runs) / 4 + 10);
+        REQUIRE(trues > runs * 0.25);
+        REQUIRE(trues < runs * 0.35);
+    }
+    SECTION("bernoulli_distribution with p = 0.5 never needs more than one chunk")
+    {
+        bit_buffer<counting_engine<xoshiro256_starstar>> b;
+        bernoulli_distribution                           d{};
+        for (int i = 0; i < 640; ++i)
+            (void)d(b);
+        REQUIRE(b.base().calls == 160);
+    }
+    SECTION("bernoulli_distribution extremes")
+    {
+        bit_buffer<xoshiro256_starstar> b;
+        bernoulli_distribution          never{0.};
+        bernoulli_distribution          always{1.};
+        for (int i = 0; i < 1000; ++i)
+        {
+            REQUIRE(!never(b));
+            REQUIRE(always(b));
+        }
+    }
+}
+EVAL_TEST_CASE("bit_buffer");
@@ -0,0 +1,108 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <bugspray/bugspray.hpp>
+#include <crand/concepts/uniform_random_bit_generator.hpp>
+#include <crand/distributions/uniform_int_distribution.hpp>
+#include <crand/engines/buffered_engine.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+#include <span>
+
+namespace
+{
+ASSERTING_FUNCTION(check_same_sequence, (auto engine, auto buffered))
+{
+    for (int i = 0; i < 1000; ++i)
+        REQUIRE(buffered() == engine());
+
+    buffered.discard(7);
+    engine.discard(7);
+    REQUIRE(buffered() == engine());
+
+    buffered.discard(1000);
+    engine.discard(1000);
+    REQUIRE(buffered() == engine());
+
+    std::array<typename decltype(engine)::result_type, 300> expected{};
+    std::array<typename decltype(engine)::result_type, 300> actual{};
+    for (auto& x : expected)
+        x = engine();
+    buffered.generate(actual);
+    REQUIRE(actual == expected);
+    REQUIRE(buffered() == engine());
+}
+} // namespace
+
+TEST_CASE("buffered_engine", "[engines]")
+{
+    using namespace crand;
+
+    SECTION("satisfies uniform_random_bit_generator")
+    {
+        REQUIRE(uniform_random_bit_generator<buffered_engine<xoshiro256_starstar>>);
+        REQUIRE(uniform_random_bit_generator<buffered_engine<chacha8, 16>>);
+    }
+    SECTION("produces the same sequence as the underlying engine")
+    {
+        CALL(check_same_sequence, xoshiro256_starstar{}, buffered_engine<xoshiro256_starstar>{});
+        CALL(check_same_sequence, xoshiro256_starstar{}, buffered_engine<xoshiro256_starstar, 1>{});
+        CALL(check_same_sequence, pcg32{42}, buffered_engine<pcg32, 100>{pcg32{42}});
+        CALL(check_same_sequence, chacha8{}, buffered_engine<chacha8, 256>{});
+    }
+    SECTION("re-seeding discards buffered values")
+    {
+        buffered_engine<pcg64> buffered;
+        (void)buffered();
+        buffered.seed(7);
+        pcg64 engine{7};
+        REQUIRE(buffered() == engine());
+    }
+    SECTION("equality considers buffered values")
+    {
+        buffered_engine<xoshiro256_starstar, 16> a;
+        buffered_engine<xoshiro256_starstar, 16> b;
+        REQUIRE(a == b);
+        (void)a();
+        REQUIRE(!(a == b));
+        (void)b();
+        REQUIRE(a == b);
+    }
+    SECTION("buffer is aligned")
+    {
+        REQUIRE(alignof(buffered_engine<xoshiro256_starstar>) >= 64);
+    }
+    SECTION("works with distributions")
+    {
+        buffered_engine<xoshiro256_starstar> buffered;
+        xoshiro256_starstar                  engine;
+        uniform_int_distribution             d{inclusive{1}, inclusive{6}};
+        for (int i = 0; i < 1000; ++i)
+            REQUIRE(d(buffered) == d(engine));
+    }
+}
+EVAL_TEST_CASE("buffered_engine");
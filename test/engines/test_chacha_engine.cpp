@@ -0,0 +1,199 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_check_uniformness.hpp"
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/generate.hpp>
+
+#include <array>
+#include <span>
+
+namespace
+{
+template<typename G, std::size_t N>
+constexpr auto generate_n(G g) -> std::array<typename G::result_type, N>
+{
+    std::array<typename G::result_type, N> out{};
+    for (auto& x : out)
+        x = g();
+    return out;
+}
+} // namespace
+
+TEST_CASE("chacha20", "[engines]")
+{
+    using namespace crand;
+    chacha20 e;
+    SECTION("should match the reference implementation")
+    {
+        SECTION("zero key, block 0")
+        {
+            chacha20                                ref{chacha20::key_type{}};
+            constexpr std::array<std::uint32_t, 16> expected{0xade0b876,
+                                                             0x903df1a0,
+                                                             0xe56a5d40,
+                                                             0x28bd8653,
+                                                             0xb819d2bd,
+                                                             0x1aed8da0,
+                                                             0xccef36a8,
+                                                             0xc70d778b,
+                                                             0x7c5941da,
+                                                             0x8d485751,
+                                                             0x3fe02477,
+                                                             0x374ad8b8,
+                                                             0xf4b8436a,
+                                                             0x1ca11815,
+                                                             0x69b687c3,
+                                                             0x8665eeb2};
+            for (auto const x : expected)
+                REQUIRE(ref() == x);
+        }
+        SECTION("RFC 7539, section 2.3.2")
+        {
+            // The RFC uses a 32 bit counter and a 96 bit nonce; the upper nonce word becomes the upper counter word.
+            constexpr chacha20::key_type key{
+                0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c, 0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c};
+            chacha20 ref{key, 0x4a000000};
+            ref.discard(0x0900000000000001ull * 16);
+            constexpr std::array<std::uint32_t, 16> expected{0xe4e7f110,
+                                                             0x15593bd1,
+                                                             0x1fdd0f50,
+                                                             0xc47120a3,
+                                                             0xc7f4d1c7,
+                                                             0x0368c033,
+                                                             0x9aaa2204,
+                                                             0x4e6cd4c3,
+                                                             0x466482d2,
+                                                             0x09aa9f07,
+                                                             0x05d7c214,
+                                                             0xa2028bd9,
+                                                             0xd19c12b5,
+                                                             0xb94e16de,
+                                                             0xe883d0cb,
+                                                             0x4e3c50a2};
+            for (auto const x : expected)
+                REQUIRE(ref() == x);
+        }
+    }
+    SECTION("discard(n) must be same as n * operator()")
+    {
+        for (auto const n : {1, 15, 16, 63, 64, 65, 200})
+        {
+            auto copy = e;
+            for (int i = 0; i < n; ++i)
+            {
+                copy();
+            }
+            e.discard(n);
+            REQUIRE(e == copy);
+            auto const first  = copy();
+            auto const second = e();
+            REQUIRE(first == second);
+        }
+    }
+    SECTION("discard(n) ending on a buffer boundary must leave the same state as n * operator()")
+    {
+        for (auto const start : {0, 1, 64})
+            for (auto const n : {0, 63, 64, 127, 128, 192})
+            {
+                chacha20 a{42u, 7u};
+                a.discard(start);
+                auto b = a;
+                for (int i = 0; i < n; ++i)
+                    a();
+                b.discard(n);
+                REQUIRE(a == b);
+                REQUIRE(a.state() == b.state());
+                REQUIRE(a() == b());
+            }
+    }
+    SECTION("discard must not overflow for large z")
+    {
+        e.discard(5);
+        auto copy = e;
+        e.discard(~0ull);
+        copy.discard(~0ull - 100);
+        copy.discard(100);
+        REQUIRE(e == copy);
+        REQUIRE(e() == copy());
+    }
+    SECTION("generate must be same as repeated operator()")
+    {
+        auto                           copy = e;
+        std::array<std::uint32_t, 10>  skip{};
+        std::array<std::uint32_t, 99>  bulk{};
+        std::array<std::uint32_t, 300> large{};
+        crand::generate(e, std::span{skip});
+        crand::generate(e, std::span{bulk});
+        for (std::size_t i = 0; i < skip.size(); ++i)
+            REQUIRE(skip[i] == copy());
+        for (std::size_t i = 0; i < bulk.size(); ++i)
+            REQUIRE(bulk[i] == copy());
+        REQUIRE(e == copy);
+        crand::generate(e, std::span{large});
+        for (std::size_t i = 0; i < large.size(); ++i)
+            REQUIRE(large[i] == copy());
+        REQUIRE(e == copy);
+        REQUIRE(e() == copy());
+    }
+    SECTION("runtime output must be identical to compile time output")
+    {
+        constexpr auto expected = generate_n<chacha20, 300>(chacha20{42u, 7u});
+        REQUIRE(generate_n<chacha20, 300>(chacha20{42u, 7u}) == expected);
+    }
+    SECTION("different streams should produce different sequences")
+    {
+        chacha20 a{42u, 1u};
+        chacha20 b{42u, 2u};
+        REQUIRE(a.stream() == 1u);
+        REQUIRE(b.stream() == 2u);
+        REQUIRE(a() != b());
+    }
+}
+EVAL_TEST_CASE("chacha20");
+
+TEST_CASE("chacha8", "[engines]")
+{
+    using namespace crand;
+    chacha8 e;
+    SECTION("discard(n) must be same as n * operator()")
+    {
+        auto       copy = e;
+        auto const n    = 100;
+        for (int i = 0; i < n; ++i)
+        {
+            copy();
+        }
+        e.discard(n);
+        auto const first  = copy();
+        auto const second = e();
+        REQUIRE(first == second);
+    }
+    SECTION("should generate approximately uniform numbers")
+    {
+        CALL(helper_check_uniformness, e, 0.15); // 32 bit output yields only half as many samples per bucket
+    }
+}
+EVAL_TEST_CASE("chacha8");
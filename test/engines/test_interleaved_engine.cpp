@@ -0,0 +1,127 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_check_generate.hpp"
+
+#include <bugspray/bugspray.hpp>
+#include <crand/concepts/uniform_random_bit_generator.hpp>
+#include <crand/engines/detail/cpu_dispatch.hpp>
+#include <crand/engines/interleaved_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+#include <tuple>
+
+namespace
+{
+// Checks that the `i`-th value belongs to stream `i % N`, for the kernel of every supported instruction set.
+ASSERTING_FUNCTION(check_interleaved_streams, (auto streams))
+{
+    namespace cd            = crand::detail::cpu_dispatch;
+    using engine_type       = typename decltype(streams)::value_type;
+    constexpr std::size_t n = std::tuple_size_v<decltype(streams)>;
+
+    int isas = 1;
+    if !consteval
+    {
+        isas = static_cast<int>(cd::detect()) + 1;
+    }
+    for (int isa = 0; isa < isas; ++isa)
+    {
+        CAPTURE(isa);
+        if !consteval
+        {
+            cd::selected = static_cast<cd::isa>(isa);
+        }
+        auto                                      expected = streams;
+        crand::interleaved_engine<engine_type, n> e{streams};
+        for (std::size_t i = 0; i < 2 * n + 3; ++i)
+            REQUIRE(e() == expected[i % n]());
+
+        std::array<typename engine_type::result_type, 5 * n + 1> out{};
+        e.generate(out);
+        for (std::size_t i = 0; i < out.size(); ++i)
+            REQUIRE(out[i] == expected[(i + 3) % n]());
+    }
+    if !consteval
+    {
+        cd::selected = cd::detect();
+    }
+}
+} // namespace
+
+TEST_CASE("interleaved_engine", "[engines]")
+{
+    using namespace crand;
+
+    SECTION("satisfies uniform_random_bit_generator")
+    {
+        REQUIRE(uniform_random_bit_generator<interleaved_engine<xoshiro256_starstar>>);
+        REQUIRE(uniform_random_bit_generator<interleaved_engine<xorshift32, 4>>);
+    }
+    SECTION("interleaves the values of its streams")
+    {
+        CALL(check_interleaved_streams, std::array{xorshift32{1}, xorshift32{2}, xorshift32{3}, xorshift32{4}});
+        CALL(check_interleaved_streams, std::array{xorshift64{1}, xorshift64{2}});
+        CALL(check_interleaved_streams, std::array{splitmix64{1}, splitmix64{2}, splitmix64{3}, splitmix64{4}});
+        std::array<xoshiro256_starstar, 8> streams;
+        for (std::size_t n = 0; n < streams.size(); ++n)
+            streams[n] = xoshiro256_starstar{n + 1};
+        CALL(check_interleaved_streams, streams);
+    }
+    SECTION("derives the streams by splitting or jumping")
+    {
+        splitmix64                        g{42};
+        interleaved_engine<splitmix64, 4> split{g};
+        std::array<splitmix64, 4>         expected_split{g.split(), g.split(), g.split(), g.split()};
+        REQUIRE(split == interleaved_engine<splitmix64, 4>{expected_split});
+
+        xoshiro256_starstar                        h{42};
+        interleaved_engine<xoshiro256_starstar, 4> jumped{h};
+        std::array<xoshiro256_starstar, 4>         expected_jumped{};
+        for (auto& stream : expected_jumped)
+        {
+            stream = h;
+            h.discard_2_to_the_128();
+        }
+        REQUIRE(jumped == interleaved_engine<xoshiro256_starstar, 4>{expected_jumped});
+    }
+    SECTION("generate must be same as repeated operator()")
+    {
+        CALL(helper_check_generate, interleaved_engine<xoshiro256_starstar>{});
+        CALL(helper_check_generate, interleaved_engine<xorshift32, 16>{});
+    }
+    SECTION("equality considers buffered values")
+    {
+        interleaved_engine<splitmix64> a;
+        interleaved_engine<splitmix64> b;
+        REQUIRE(a == b);
+        (void)a();
+        REQUIRE(!(a == b));
+        (void)b();
+        REQUIRE(a == b);
+    }
+}
+EVAL_TEST_CASE("interleaved_engine");
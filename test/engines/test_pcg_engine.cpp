@@ -0,0 +1,135 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_check_uniformness.hpp"
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/pcg_engine.hpp>
+
+#include <array>
+#include <limits>
+
+TEST_CASE("pcg32", "[engines]")
+{
+    using namespace crand;
+    pcg32 e;
+    SECTION("should match the reference implementation")
+    {
+        pcg32                                  ref{42u, 54u};
+        constexpr std::array<std::uint32_t, 6> expected{0xa15c02b7,
+                                                        0x7b47f409,
+                                                        0xba1d3330,
+                                                        0x83d2f293,
+                                                        0xbfa4784b,
+                                                        0xcbed606e};
+        for (auto const x : expected)
+            REQUIRE(ref() == x);
+    }
+    SECTION("discard(n) must be same as n * operator()")
+    {
+        auto       copy = e;
+        auto const n    = 32;
+        for (int i = 0; i < n; ++i)
+        {
+            copy();
+        }
+        e.discard(n);
+        auto const first  = copy();
+        auto const second = e();
+        REQUIRE(first == second);
+    }
+    SECTION("discarding the full period must return to the original state")
+    {
+        auto const copy = e;
+        e.discard(std::numeric_limits<unsigned long long>::max());
+        e();
+        REQUIRE(e == copy);
+    }
+    SECTION("different streams should produce different sequences")
+    {
+        pcg32 a{42u, 1u};
+        pcg32 b{42u, 2u};
+        REQUIRE(a.stream() == 1u);
+        REQUIRE(b.stream() == 2u);
+        REQUIRE(a() != b());
+    }
+    SECTION("should generate approximately uniform numbers")
+    {
+        CALL(helper_check_uniformness, e, 0.15); // 32 bit output yields only half as many samples per bucket
+    }
+}
+EVAL_TEST_CASE("pcg32");
+
+TEST_CASE("pcg64", "[engines]")
+{
+    using namespace crand;
+    pcg64 e;
+    SECTION("should match the reference implementation")
+    {
+        pcg64                                  ref{42u, 54u};
+        constexpr std::array<std::uint64_t, 6> expected{0xf0847c9518bddb90,
+                                                        0x8e7d5f5514ba8aaa,
+                                                        0x86fbd36f8028f6fd,
+                                                        0x8d14b6edbe9f740a,
+                                                        0xa85b2896c7cad55d,
+                                                        0x8ca3894a1d9227bb};
+        for (auto const x : expected)
+            REQUIRE(ref() == x);
+    }
+    SECTION("discard(n) must be same as n * operator()")
+    {
+        auto       copy = e;
+        auto const n    = 32;
+        for (int i = 0; i < n; ++i)
+        {
+            copy();
+        }
+        e.discard(n);
+        auto const first  = copy();
+        auto const second = e();
+        REQUIRE(first == second);
+    }
+    SECTION("discard(a + b) must be same as discard(a) and discard(b)")
+    {
+        auto           copy = e;
+        constexpr auto a    = 0x123456789abcdefull;
+        constexpr auto b    = 0xfedcba987654321ull;
+        copy.discard(a);
+        copy.discard(b);
+        e.discard(a + b);
+        REQUIRE(e == copy);
+    }
+    SECTION("different streams should produce different sequences")
+    {
+        pcg64 a{42u, 1u};
+        pcg64 b{42u, 2u};
+        REQUIRE(a.stream() == 1u);
+        REQUIRE(b.stream() == 2u);
+        REQUIRE(a() != b());
+    }
+    SECTION("should generate approximately uniform numbers")
+    {
+        CALL(helper_check_uniformness, e, 0.10);
+    }
+}
+EVAL_TEST_CASE("pcg64");
@@ -0,0 +1,141 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include <bugspray/bugspray.hpp>
+#include <crand/concepts/seed_sequence.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/seed_seq.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+#include <random>
+
+namespace
+{
+template<typename T>
+constexpr auto generate_words(T const& seq) -> std::array<std::uint32_t, 16>
+{
+    std::array<std::uint32_t, 16> words{};
+    seq.generate(words.begin(), words.end());
+    return words;
+}
+
+ASSERTING_FUNCTION(check_seeding, (auto engine))
+{
+    using engine_t = decltype(engine);
+
+    crand::seed_seq const seq{1, 2, 3};
+    engine_t              a{seq};
+    engine_t              b{crand::seed_seq{1, 2, 3}};
+    engine_t              c{crand::seed_seq{1, 2, 4}};
+    REQUIRE(a == b);
+    REQUIRE(!(a == c));
+
+    engine.seed(seq);
+    REQUIRE(engine == a);
+    REQUIRE(engine() == b());
+
+    auto const engines = crand::make_engines<engine_t, 3>(seq);
+    REQUIRE(engines[0] == engine_t{seq.spawn(0)});
+    REQUIRE(!(engines[0] == engines[1]));
+    REQUIRE(!(engines[1] == engines[2]));
+}
+} // namespace
+
+TEST_CASE("seed_seq", "[engines]")
+{
+    using namespace crand;
+
+    SECTION("satisfies seed_sequence")
+    {
+        REQUIRE(seed_sequence<seed_seq>);
+        REQUIRE(seed_sequence<seed_seq const&>);
+        REQUIRE(seed_sequence<std::seed_seq>);
+        REQUIRE(!seed_sequence<std::seed_seq const&>);
+        REQUIRE(!seed_sequence<xoshiro256_starstar>);
+        REQUIRE(!seed_sequence<chacha20>);
+    }
+    SECTION("generate is deterministic")
+    {
+        seed_seq const seq{42};
+        REQUIRE(generate_words(seq) == generate_words(seq));
+        REQUIRE(generate_words(seq) == generate_words(seed_seq{42}));
+    }
+    SECTION("different seed material produces different values")
+    {
+        REQUIRE(generate_words(seed_seq{}) != generate_words(seed_seq{0}));
+        REQUIRE(generate_words(seed_seq{1}) != generate_words(seed_seq{2}));
+        REQUIRE(generate_words(seed_seq{1, 2}) != generate_words(seed_seq{2, 1}));
+        REQUIRE(generate_words(seed_seq{std::string_view{"ab"}})
+                != generate_words(seed_seq{std::string_view{"ab\0", 3}}));
+    }
+    SECTION("wide integers are not truncated")
+    {
+        std::uint64_t const low  = 1;
+        std::uint64_t const high = low | (std::uint64_t{1} << 32u);
+        REQUIRE(generate_words(seed_seq{low}) != generate_words(seed_seq{high}));
+    }
+    SECTION("late seed material affects all values")
+    {
+        auto const a = generate_words(seed_seq{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+        auto const b = generate_words(seed_seq{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1});
+        for (std::size_t i = 0; i < a.size(); ++i)
+            REQUIRE(a[i] != b[i]);
+    }
+    SECTION("spawned children differ from the parent and each other")
+    {
+        seed_seq const seq{__DATE__ " " __TIME__ " " __FILE__};
+        REQUIRE(seq.spawn(0) != seq);
+        REQUIRE(seq.spawn(0) != seq.spawn(1));
+        REQUIRE(seq.spawn(1) == seq.spawn(1));
+    }
+    SECTION("every engine can be seeded from a seed sequence")
+    {
+        CALL(check_seeding, chacha20{});
+        CALL(check_seeding, pcg32{});
+        CALL(check_seeding, pcg64{});
+        CALL(check_seeding, romu_duo{});
+        CALL(check_seeding, romu_trio{});
+        CALL(check_seeding, splitmix64{});
+        CALL(check_seeding, wyrand{});
+        CALL(check_seeding, xorshift32{});
+        CALL(check_seeding, xorshift64{});
+        CALL(check_seeding, xoshiro256_starstar{});
+    }
+    SECTION("engines can be seeded from std::seed_seq")
+    {
+        if (!std::is_constant_evaluated())
+        {
+            std::seed_seq       seq{1, 2, 3};
+            xoshiro256_starstar a{seq};
+            xoshiro256_starstar b{seq};
+            REQUIRE(a == b);
+        }
+    }
+}
+EVAL_TEST_CASE("seed_seq");
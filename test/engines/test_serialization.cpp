@@ -0,0 +1,159 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <bugspray/bugspray.hpp>
+#include <crand/concepts/serializable_engine.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/serialization.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <array>
+#include <sstream>
+#include <type_traits>
+
+#include <cstddef>
+#include <cstring>
+
+namespace
+{
+ASSERTING_FUNCTION(check_serialization, (auto engine))
+{
+    using engine_t = decltype(engine);
+
+    REQUIRE(crand::serializable_engine<engine_t>);
+    REQUIRE(std::is_trivially_copyable_v<engine_t>);
+
+    engine.discard(100);
+
+    auto const from_state = engine_t::from_state(engine.state());
+    REQUIRE(from_state == engine);
+
+    auto const bytes = crand::to_bytes(engine);
+    REQUIRE(bytes.size() == crand::serialized_size_v<engine_t>);
+    auto const from_bytes = crand::from_bytes<engine_t>(bytes);
+    REQUIRE(from_bytes == engine);
+
+    auto a = from_state;
+    auto b = from_bytes;
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto const expected = engine();
+        REQUIRE(a() == expected);
+        REQUIRE(b() == expected);
+    }
+
+    if (!std::is_constant_evaluated())
+    {
+        std::stringstream ss;
+        ss << std::hex << engine;
+        REQUIRE((ss.flags() & std::ios_base::basefield) == std::ios_base::hex);
+
+        engine_t restored;
+        ss >> restored;
+        REQUIRE(!ss.fail());
+        REQUIRE(restored == engine);
+
+        std::stringstream invalid{"not a state"};
+        invalid >> restored;
+        REQUIRE(invalid.fail());
+        REQUIRE(restored == engine);
+
+        std::array<engine_t, 2> const engines{engine, a};
+        std::array<engine_t, 2>       copies;
+        std::memcpy(copies.data(), engines.data(), sizeof(engines));
+        REQUIRE(copies[0] == engines[0]);
+        REQUIRE(copies[1] == engines[1]);
+        REQUIRE(copies[0]() == engine());
+    }
+}
+} // namespace
+
+TEST_CASE("serialization", "[engines]")
+{
+    using namespace crand;
+
+    SECTION("engines round-trip through state, bytes and streams")
+    {
+        CALL(check_serialization, chacha8{});
+        CALL(check_serialization, pcg32{});
+        CALL(check_serialization, pcg64{});
+        CALL(check_serialization, romu_duo{});
+        CALL(check_serialization, romu_trio{});
+        CALL(check_serialization, splitmix64{});
+        CALL(check_serialization, wyrand{});
+        CALL(check_serialization, xorshift32{});
+        CALL(check_serialization, xorshift64{});
+        CALL(check_serialization, xoshiro256_starstar{});
+    }
+    SECTION("binary representation is little endian")
+    {
+        auto const bytes = to_bytes(xorshift64::from_state({0x0102030405060708}));
+        REQUIRE(bytes.size() == 8);
+        for (std::size_t i = 0; i < bytes.size(); ++i)
+            REQUIRE(bytes[i] == static_cast<std::byte>(8 - i));
+    }
+    SECTION("state of pcg64 is stored most significant word first")
+    {
+        pcg64 const engine{42, 54};
+        REQUIRE(engine.state()[2] == 0);
+        REQUIRE(engine.state()[3] == 2 * 54 + 1);
+    }
+    SECTION("chacha state preserves the position within the buffered blocks")
+    {
+        chacha20 engine{7, 3};
+        engine.discard(70);
+        auto const state = engine.state();
+        REQUIRE(state[8] == 3);
+        REQUIRE(state[10] == 4);
+        REQUIRE(state[12] == 6);
+
+        auto restored = chacha20::from_state(state);
+        REQUIRE(restored() == engine());
+    }
+    SECTION("chacha positions beyond the buffered blocks are folded into the counter")
+    {
+        chacha20 engine{7, 3};
+        auto     state = engine.state();
+        state[12]      = 0xffffffff;
+        auto restored  = chacha20::from_state(state);
+        engine.discard(0xffffffff);
+        REQUIRE(restored == engine);
+        REQUIRE(restored() == engine());
+    }
+    SECTION("stream output matches word order of state")
+    {
+        if (!std::is_constant_evaluated())
+        {
+            std::ostringstream ss;
+            ss << xoshiro256_starstar::from_state({1, 2, 3, 4});
+            REQUIRE(ss.str() == "1 2 3 4");
+        }
+    }
+}
+EVAL_TEST_CASE("serialization");
@@ -21,6 +21,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
+#include "helper_check_generate.hpp"
 #include "helper_check_uniformness.hpp"
 
 #include <bugspray/bugspray.hpp>
@@ -43,6 +44,10 @@ TEST_CASE("splitmix64", "[engines]")
         auto const second = e();
         REQUIRE(first == second);
     }
+    SECTION("generate must be same as repeated operator()")
+    {
+        CALL(helper_check_generate, e);
+    }
     SECTION("should generate approximately uniform numbers")
     {
         CALL(helper_check_uniformness, e, 0.10);
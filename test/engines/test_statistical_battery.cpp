@@ -0,0 +1,95 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_statistical_battery.hpp"
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+// The battery draws tens of millions of numbers, which is too much for constant evaluation. It is therefore only run
+// at runtime.
+TEST_CASE("statistical battery", "[engines]")
+{
+    using namespace crand;
+    SECTION("chacha8")
+    {
+        chacha8 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("chacha20")
+    {
+        chacha20 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("pcg32")
+    {
+        pcg32 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("pcg64")
+    {
+        pcg64 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("romu_duo")
+    {
+        romu_duo e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("romu_trio")
+    {
+        romu_trio e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("splitmix64")
+    {
+        splitmix64 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("wyrand")
+    {
+        wyrand e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("xorshift64")
+    {
+        xorshift64 e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("xoshiro256_starstar")
+    {
+        xoshiro256_starstar e;
+        CALL(helper_check_statistical_battery, e);
+    }
+    SECTION("matrix rank test should detect the linearity of xorshift32")
+    {
+        xorshift32 e;
+        REQUIRE(matrix_rank_test(e, 0) > 10.);
+    }
+}
@@ -0,0 +1,135 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/stream_file.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <span>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+template<typename E>
+constexpr auto write_to_vector(E const& engine, std::uint64_t count, std::uint64_t interval) -> std::vector<std::byte>
+{
+    std::vector<std::byte> file;
+    auto const             append = [&](std::span<std::byte const> chunk) {
+        file.insert(file.end(), chunk.begin(), chunk.end());
+    };
+    crand::write_stream_file(append, engine, "test", 42, count, interval);
+    return file;
+}
+
+ASSERTING_FUNCTION(check_stream_file, (auto engine, std::uint64_t count, std::uint64_t interval))
+{
+    using engine_t = decltype(engine);
+
+    auto const file = write_to_vector(engine, count, interval);
+    auto const view = crand::stream_file_view<engine_t>::open(file, "test");
+    REQUIRE(view.has_value());
+    REQUIRE(view->size() == count);
+    REQUIRE(view->header().file_size() == file.size());
+    REQUIRE(view->header().checkpoint_count() == count / interval + 1);
+
+    auto g = engine;
+    for (std::uint64_t i = 0; i < count; ++i)
+        REQUIRE((*view)[i] == g());
+
+    for (std::uint64_t position : {std::uint64_t{0}, interval - 1, interval, count / 2, count, count + interval + 3})
+    {
+        auto expected = engine;
+        expected.discard(position);
+        REQUIRE(view->engine_at(position) == expected);
+    }
+}
+} // namespace
+
+TEST_CASE("stream_file", "[engines]")
+{
+    using namespace crand;
+
+    SECTION("values and checkpoints can be read back")
+    {
+        CALL(check_stream_file, xoshiro256_starstar{}, 2500, 1000);
+        CALL(check_stream_file, xoshiro256_starstar{}, 3000, 1000);
+        CALL(check_stream_file, pcg32{}, 777, 64);
+        CALL(check_stream_file, chacha8{}, 333, 100);
+    }
+    SECTION("header round-trips")
+    {
+        stream_file_header header;
+        header.engine[0]           = 'a';
+        header.seed                = 1;
+        header.count               = 2;
+        header.checkpoint_interval = 3;
+        header.word_bytes          = 4;
+        header.state_bytes         = 5;
+        REQUIRE(header.engine_id() == "a");
+
+        auto const bytes   = header.encode();
+        auto const decoded = stream_file_header::decode(bytes);
+        REQUIRE(decoded.has_value());
+        REQUIRE(*decoded == header);
+    }
+    SECTION("values are aligned and stored in little-endian byte order")
+    {
+        auto const file = write_to_vector(pcg32{}, 10, 4);
+        REQUIRE(stream_file_header::data_offset() % 64 == 0);
+        REQUIRE(stream_file_header::decode(file)->checkpoint_offset() % 8 == 0);
+
+        auto const first = pcg32{}();
+        for (std::size_t b = 0; b < 4; ++b)
+            REQUIRE(file[stream_file_header::data_offset() + b] == static_cast<std::byte>(first >> (8 * b)));
+    }
+    SECTION("invalid files are rejected")
+    {
+        auto file = write_to_vector(xoshiro256_starstar{}, 100, 10);
+        REQUIRE(stream_file_view<xoshiro256_starstar>::open(file).has_value());
+        REQUIRE(!stream_file_view<xoshiro256_starstar>::open(file, "other").has_value());
+        REQUIRE(!stream_file_view<pcg32>::open(file).has_value());
+        REQUIRE(!stream_file_view<xoshiro256_starstar>::open(std::span{file}.first(file.size() - 1)).has_value());
+
+        file[0] = std::byte{0};
+        REQUIRE(!stream_file_view<xoshiro256_starstar>::open(file).has_value());
+    }
+    SECTION("headers whose file size overflows are rejected")
+    {
+        stream_file_header header;
+        header.count               = std::uint64_t{1} << 62u;
+        header.checkpoint_interval = 1;
+        header.word_bytes          = 1;
+        header.state_bytes         = 32;
+        REQUIRE(!stream_file_header::decode(header.encode()).has_value());
+
+        header.state_bytes = 2;
+        REQUIRE(stream_file_header::decode(header.encode()).has_value());
+    }
+}
+EVAL_TEST_CASE("stream_file");
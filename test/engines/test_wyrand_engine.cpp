@@ -0,0 +1,63 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "helper_check_uniformness.hpp"
+
+#include <bugspray/bugspray.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+
+#include <array>
+
+TEST_CASE("wyrand", "[engines]")
+{
+    using namespace crand;
+    wyrand e;
+    SECTION("should match the reference implementation")
+    {
+        wyrand                                 ref{42u};
+        constexpr std::array<std::uint64_t, 4> expected{0xca71d87c76983989,
+                                                        0x7e5ba61552085fc6,
+                                                        0xcdf101e3bab88b9f,
+                                                        0x0a3825ad73267808};
+        for (auto const x : expected)
+            REQUIRE(ref() == x);
+    }
+    SECTION("discard(n) must be same as n * operator()")
+    {
+        auto       copy = e;
+        auto const n    = 32;
+        for (int i = 0; i < n; ++i)
+        {
+            copy();
+        }
+        e.discard(n);
+        auto const first  = copy();
+        auto const second = e();
+        REQUIRE(first == second);
+    }
+    SECTION("should generate approximately uniform numbers")
+    {
+        CALL(helper_check_uniformness, e, 0.10);
+    }
+}
+EVAL_TEST_CASE("wyrand");
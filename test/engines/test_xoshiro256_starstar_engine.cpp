@@ -22,6 +22,7 @@
 // SOFTWARE.
 //
 
+#include "helper_check_generate.hpp"
 #include "helper_check_uniformness.hpp"
 
 #include <bugspray/bugspray.hpp>
@@ -44,6 +45,10 @@ TEST_CASE("xoshiro256_starstar", "[engines]")
         auto const second = e();
         REQUIRE(first == second);
     }
+    SECTION("generate must be same as repeated operator()")
+    {
+        CALL(helper_check_generate, e);
+    }
     SECTION("should generate approximately uniform numbers")
     {
         CALL(helper_check_uniformness, e, 0.10);
@@ -0,0 +1,89 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef CONSTEXPR_RANDOM_HELPER_CHECK_SEQUENCE_HPP
+#define CONSTEXPR_RANDOM_HELPER_CHECK_SEQUENCE_HPP
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// Checks that the `count` points starting at the current index hit each of the `count` intervals of equal length
+// exactly once in coordinate `dim`, and that all coordinates lie in [0, 1). Points on an interval boundary may be
+// rounded down by one ulp, hence the tolerance.
+ASSERTING_FUNCTION(helper_check_stratified, (auto seq, std::size_t dim, std::size_t count))
+{
+    std::vector<int> hits(count);
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        auto const p = seq();
+        for (auto const x : p)
+        {
+            REQUIRE(x >= 0);
+            REQUIRE(x < 1);
+        }
+        ++hits[static_cast<std::size_t>(p[dim] * static_cast<double>(count) + 1e-9)];
+    }
+    for (auto const h : hits)
+        REQUIRE(h == 1);
+}
+
+// Checks that `seek`, `discard` and `generate` agree with stepping through the sequence one point at a time.
+ASSERTING_FUNCTION(helper_check_seek_and_generate, (auto seq))
+{
+    constexpr std::size_t dims   = std::tuple_size_v<typename decltype(seq)::result_type>;
+    constexpr std::size_t points = 37;
+
+    auto stepped = seq;
+    for (int i = 0; i < 1000; ++i)
+        stepped();
+
+    auto sought = seq;
+    sought.seek(1000);
+    REQUIRE(sought.index() == 1000);
+    REQUIRE(sought == stepped);
+
+    auto discarded = seq;
+    discarded.discard(400);
+    discarded.discard(600);
+    REQUIRE(discarded == stepped);
+
+    std::vector<typename decltype(seq)::result_type::value_type> out(dims * points);
+    sought.generate(std::span{out});
+    REQUIRE(sought.index() == 1000 + points);
+    for (std::size_t j = 0; j < points; ++j)
+    {
+        auto const p = stepped();
+        for (std::size_t k = 0; k < dims; ++k)
+            REQUIRE(out[k * points + j] == p[k]);
+    }
+    REQUIRE(sought == stepped);
+}
+
+#endif // CONSTEXPR_RANDOM_HELPER_CHECK_SEQUENCE_HPP
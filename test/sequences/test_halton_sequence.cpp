@@ -0,0 +1,100 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+#include "crand/sequences/halton_sequence.hpp"
+#include "helper_check_sequence.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+
+#include <cmath>
+#include <cstddef>
+
+TEST_CASE("halton_sequence", "[sequences]")
+{
+    using namespace crand;
+
+    SECTION("bases")
+    {
+        constexpr std::array<std::uint64_t, 8> primes{2, 3, 5, 7, 11, 13, 17, 19};
+        REQUIRE(halton_sequence<double, 8>::bases() == primes);
+    }
+    SECTION("first points")
+    {
+        constexpr std::array<std::array<double, 2>, 5> expected{{
+            {0, 0},
+            {1. / 2, 1. / 3},
+            {1. / 4, 2. / 3},
+            {3. / 4, 1. / 9},
+            {1. / 8, 4. / 9},
+        }};
+
+        halton_sequence<double, 2> seq;
+        REQUIRE(!seq.is_scrambled());
+        for (auto const& e : expected)
+        {
+            auto const p = seq();
+            REQUIRE(std::abs(p[0] - e[0]) < 1e-15);
+            REQUIRE(std::abs(p[1] - e[1]) < 1e-15);
+        }
+    }
+    SECTION("every coordinate is stratified")
+    {
+        halton_sequence<double, 4> seq;
+        CALL(helper_check_stratified, seq, 0, 64);
+        CALL(helper_check_stratified, seq, 1, 81);
+        CALL(helper_check_stratified, seq, 2, 125);
+        CALL(helper_check_stratified, seq, 3, 49);
+
+        seq.seek(125);
+        CALL(helper_check_stratified, seq, 2, 125);
+    }
+    SECTION("seek, discard and generate")
+    {
+        CALL(helper_check_seek_and_generate, halton_sequence<double, 5>{});
+        CALL(helper_check_seek_and_generate, halton_sequence<float, 30>{});
+    }
+    SECTION("scrambled")
+    {
+        xoshiro256_starstar e;
+        auto const          seq = halton_sequence<double, 3>::scrambled(e);
+        REQUIRE(seq.is_scrambled());
+        REQUIRE(seq != halton_sequence<double, 3>{});
+
+        auto copy = seq;
+        REQUIRE(copy()[0] != 0);
+
+        CALL(helper_check_stratified, seq, 0, 64);
+        CALL(helper_check_stratified, seq, 1, 81);
+        CALL(helper_check_stratified, seq, 2, 125);
+        CALL(helper_check_seek_and_generate, seq);
+
+        auto later = seq;
+        later.seek(250);
+        CALL(helper_check_stratified, later, 2, 125);
+    }
+}
+EVAL_TEST_CASE("halton_sequence");
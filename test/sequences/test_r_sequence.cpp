@@ -0,0 +1,81 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+#include "crand/sequences/r_sequence.hpp"
+#include "helper_check_sequence.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+ASSERTING_FUNCTION(check_increments, (auto seq, auto const& alpha))
+{
+    auto const first  = seq();
+    auto const second = seq();
+    for (std::size_t i = 0; i < alpha.size(); ++i)
+    {
+        auto step = second[i] - first[i];
+        if (step < 0)
+            step += 1;
+        REQUIRE(std::abs(step - alpha[i]) < 1e-12);
+    }
+}
+
+TEST_CASE("r_sequence", "[sequences]")
+{
+    using namespace crand;
+
+    SECTION("increments")
+    {
+        CALL(check_increments, r_sequence<double, 1>{}, std::array{0.6180339887498949});
+        CALL(check_increments, r_sequence<double, 2>{}, std::array{0.7548776662466927, 0.5698402909980532});
+    }
+    SECTION("starts at the origin")
+    {
+        r_sequence<double, 3> seq;
+        REQUIRE(!seq.is_scrambled());
+        REQUIRE(seq() == std::array<double, 3>{});
+    }
+    SECTION("seek, discard and generate")
+    {
+        CALL(helper_check_seek_and_generate, r_sequence<double, 5>{});
+        CALL(helper_check_seek_and_generate, r_sequence<float, 30>{});
+    }
+    SECTION("scrambled")
+    {
+        xoshiro256_starstar e;
+        auto const          seq = r_sequence<double, 2>::scrambled(e);
+        REQUIRE(seq.is_scrambled());
+        REQUIRE(seq != r_sequence<double, 2>{});
+
+        auto copy = seq;
+        REQUIRE(copy()[0] != 0);
+
+        CALL(check_increments, seq, std::array{0.7548776662466927, 0.5698402909980532});
+        CALL(helper_check_seek_and_generate, seq);
+    }
+}
+EVAL_TEST_CASE("r_sequence");
@@ -0,0 +1,118 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+#include "crand/sequences/sobol_sequence.hpp"
+#include "helper_check_sequence.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <array>
+
+#include <cstddef>
+
+ASSERTING_FUNCTION(check_net_2d, (auto seq, std::size_t m))
+{
+    std::array<std::array<double, 2>, 64> points;
+    std::size_t const                     count = std::size_t{1} << m;
+    for (std::size_t n = 0; n < count; ++n)
+        points[n] = seq();
+
+    for (std::size_t a = 0; a <= m; ++a)
+    {
+        std::array<int, 64> hits{};
+        std::size_t const   cols = std::size_t{1} << a;
+        std::size_t const   rows = count / cols;
+        for (std::size_t n = 0; n < count; ++n)
+        {
+            auto const x = static_cast<std::size_t>(points[n][0] * static_cast<double>(cols));
+            auto const y = static_cast<std::size_t>(points[n][1] * static_cast<double>(rows));
+            ++hits[y * cols + x];
+        }
+        for (std::size_t b = 0; b < count; ++b)
+            REQUIRE(hits[b] == 1);
+    }
+}
+
+TEST_CASE("sobol_sequence", "[sequences]")
+{
+    using namespace crand;
+
+    SECTION("first points")
+    {
+        constexpr std::array<std::array<double, 2>, 8> expected{{
+            {0, 0},
+            {0.5, 0.5},
+            {0.75, 0.25},
+            {0.25, 0.75},
+            {0.375, 0.375},
+            {0.875, 0.875},
+            {0.625, 0.125},
+            {0.125, 0.625},
+        }};
+
+        sobol_sequence<double, 2> seq;
+        REQUIRE(!seq.is_scrambled());
+        for (auto const& e : expected)
+            REQUIRE(seq() == e);
+        REQUIRE(seq.index() == 8);
+    }
+    SECTION("every coordinate is stratified")
+    {
+        sobol_sequence<double, 21> seq;
+        for (std::size_t dim = 0; dim < 21; ++dim)
+            CALL(helper_check_stratified, seq, dim, 64);
+
+        seq.seek(192);
+        CALL(helper_check_stratified, seq, 20, 64);
+    }
+    SECTION("first two coordinates form a (0, m, 2)-net")
+    {
+        CALL(check_net_2d, sobol_sequence<double, 2>{}, 6);
+    }
+    SECTION("seek, discard and generate")
+    {
+        CALL(helper_check_seek_and_generate, sobol_sequence<double, 5>{});
+        CALL(helper_check_seek_and_generate, sobol_sequence<float, 21>{});
+    }
+    SECTION("scrambled")
+    {
+        xoshiro256_starstar e;
+        auto const          seq = sobol_sequence<double, 8>::scrambled(e);
+        REQUIRE(seq.is_scrambled());
+        REQUIRE(seq != sobol_sequence<double, 8>{});
+
+        auto copy = seq;
+        REQUIRE(copy()[0] != 0);
+
+        for (std::size_t dim = 0; dim < 8; ++dim)
+            CALL(helper_check_stratified, seq, dim, 64);
+        CALL(helper_check_seek_and_generate, seq);
+
+        xoshiro256_starstar e2;
+        auto                seq2 = sobol_sequence<double, 2>::scrambled(e2);
+        CALL(check_net_2d, seq2, 6);
+    }
+}
+EVAL_TEST_CASE("sobol_sequence");
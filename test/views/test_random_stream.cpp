@@ -0,0 +1,98 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/bernoulli_distribution.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+#include "crand/views/random_stream.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <ranges>
+#include <utility>
+
+// Coroutines can't be evaluated at compile time, so this is only run at runtime.
+TEST_CASE("random_stream", "[views]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+    auto                engine_copy = e;
+
+    uniform_int_distribution const dice{inclusive{1}, inclusive{6}};
+
+    SECTION("satisfies the range concepts")
+    {
+        REQUIRE(std::ranges::view<random_stream<int>>);
+        REQUIRE(std::ranges::input_range<random_stream<int>>);
+    }
+    SECTION("chunks concatenate to the same values as the distribution")
+    {
+        int chunks = 0;
+        for (auto const chunk : generate_chunks(e, dice, 100) | std::views::take(5))
+        {
+            REQUIRE(chunk.size() == 100);
+            for (auto const x : chunk)
+                REQUIRE(x == dice(engine_copy));
+            ++chunks;
+        }
+        REQUIRE(chunks == 5);
+    }
+    SECTION("chunks are generated lazily")
+    {
+        auto stream = generate_chunks(e, dice, 10);
+        REQUIRE(e == engine_copy);
+
+        auto it = stream.begin();
+        for (auto const x : *it)
+            REQUIRE(x == dice(engine_copy));
+        REQUIRE(e == engine_copy);
+
+        ++it;
+        for (auto const x : *it)
+            REQUIRE(x == dice(engine_copy));
+        REQUIRE(e == engine_copy);
+    }
+    SECTION("works with stateful distributions and odd chunk sizes")
+    {
+        normal_distribution d;
+        auto                d_copy = d;
+        for (auto const chunk : generate_chunks(e, d, 7) | std::views::take(3))
+            for (auto const x : chunk)
+                REQUIRE(x == d_copy(engine_copy));
+    }
+    SECTION("works with bool")
+    {
+        bernoulli_distribution const d{0.3};
+        for (auto const chunk : generate_chunks(e, d, 64) | std::views::take(2))
+            for (auto const x : chunk)
+                REQUIRE(x == d(engine_copy));
+    }
+    SECTION("streams can be moved")
+    {
+        auto stream = generate_chunks(e, dice, 16);
+        auto moved  = std::move(stream);
+        for (auto const x : *moved.begin())
+            REQUIRE(x == dice(engine_copy));
+    }
+}
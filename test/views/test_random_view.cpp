@@ -0,0 +1,131 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "crand/distributions/bernoulli_distribution.hpp"
+#include "crand/distributions/normal_distribution.hpp"
+#include "crand/distributions/static_uniform_int_distribution.hpp"
+#include "crand/distributions/uniform_int_distribution.hpp"
+#include "crand/engines/xoshiro256_starstar_engine.hpp"
+#include "crand/views/random_view.hpp"
+
+#include <bugspray/bugspray.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+TEST_CASE("random_view", "[views]")
+{
+    using namespace crand;
+    xoshiro256_starstar e;
+    auto                engine_copy = e;
+
+    uniform_int_distribution const dice{inclusive{1}, inclusive{6}};
+
+    SECTION("satisfies the range concepts")
+    {
+        using view = random_view<xoshiro256_starstar, uniform_int_distribution<int>>;
+        REQUIRE(std::ranges::view<view>);
+        REQUIRE(std::ranges::input_range<view>);
+        REQUIRE(!std::ranges::forward_range<view>);
+        REQUIRE(std::same_as<std::ranges::range_value_t<view>, int>);
+    }
+    SECTION("produces the same values as the distribution")
+    {
+        std::vector<int> values;
+        std::ranges::copy(views::random(e, dice) | std::views::take(300), std::back_inserter(values));
+        REQUIRE(values.size() == 300);
+        for (auto const x : values)
+            REQUIRE(x == dice(engine_copy));
+    }
+    SECTION("generates blocks lazily")
+    {
+        auto v = views::random(e, dice);
+        REQUIRE(e == engine_copy);
+
+        auto it = v.begin();
+        REQUIRE(e == engine_copy);
+        REQUIRE(*it == dice(engine_copy));
+        for (int i = 1; i < 64; ++i)
+            REQUIRE(*++it == dice(engine_copy));
+        REQUIRE(e == engine_copy);
+        REQUIRE(*++it == dice(engine_copy));
+    }
+    SECTION("values can be skipped without reading them")
+    {
+        auto v  = views::random(e, dice);
+        auto it = v.begin();
+        ++it;
+        (void)dice(engine_copy);
+        REQUIRE(*it == dice(engine_copy));
+        for (int i = 0; i < 200; ++i)
+        {
+            ++it;
+            (void)dice(engine_copy);
+        }
+        REQUIRE(*++it == dice(engine_copy));
+    }
+    SECTION("works with views::drop")
+    {
+        std::vector<int> values;
+        std::ranges::copy(views::random(e, dice) | std::views::drop(3) | std::views::take(100),
+                          std::back_inserter(values));
+        for (int i = 0; i < 3; ++i)
+            (void)dice(engine_copy);
+        for (auto const x : values)
+            REQUIRE(x == dice(engine_copy));
+    }
+    SECTION("continues where the last iteration stopped")
+    {
+        auto             v = views::random(e, dice);
+        std::vector<int> values;
+        std::ranges::copy(std::ranges::ref_view{v} | std::views::take(10), std::back_inserter(values));
+        std::ranges::copy(std::ranges::ref_view{v} | std::views::take(10), std::back_inserter(values));
+        REQUIRE(values.size() == 20);
+        for (auto const x : values)
+            REQUIRE(x == dice(engine_copy));
+    }
+    SECTION("works with distributions without a batch path")
+    {
+        static_uniform_int_distribution<int, 1, 6> const d;
+        for (auto const x : views::random(e, d) | std::views::take(100))
+            REQUIRE(x == d(engine_copy));
+    }
+    SECTION("works with stateful distributions")
+    {
+        normal_distribution d;
+        auto                d_copy = d;
+        for (auto const x : views::random(e, d) | std::views::take(101))
+            REQUIRE(x == d_copy(engine_copy));
+    }
+    SECTION("works with custom block sizes")
+    {
+        bernoulli_distribution const                                d{0.3};
+        random_view<xoshiro256_starstar, bernoulli_distribution, 7> v{e, d};
+        for (auto const x : std::move(v) | std::views::take(50))
+            REQUIRE(x == d(engine_copy));
+    }
+}
+EVAL_TEST_CASE("random_view");
@@ -0,0 +1,126 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Writes the raw output of an engine to stdout, e.g. for piping into PractRand:
+//
+//     constexpr_random-stream xoshiro256_starstar | RNG_test stdin64
+//
+// Usage: constexpr_random-stream <engine> [seed] [bytes]
+
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/generate.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstdint>
+#include <cstdio>
+
+namespace
+{
+constexpr std::size_t buffer_bytes = std::size_t{1} << 20u;
+
+template<typename G>
+auto stream(std::uint64_t seed, std::uint64_t bytes) -> int
+{
+    using result_type = typename G::result_type;
+
+    G                        g(seed);
+    std::vector<result_type> buffer(buffer_bytes / sizeof(result_type));
+    std::setvbuf(stdout, nullptr, _IONBF, 0); // The buffer above is large enough; avoid a second copy
+    while (bytes > 0)
+    {
+        crand::generate(g, std::span{buffer});
+        auto const n = static_cast<std::size_t>(std::min<std::uint64_t>(bytes, buffer_bytes));
+        if (std::fwrite(buffer.data(), 1, n, stdout) != n)
+            return 1;
+        bytes -= n;
+    }
+    return 0;
+}
+
+struct engine_entry
+{
+    std::string_view name;
+    int (*stream)(std::uint64_t seed, std::uint64_t bytes);
+    std::size_t result_bits;
+};
+
+constexpr std::array engines{
+    engine_entry{"chacha8", &stream<crand::chacha8>, 32},
+    engine_entry{"chacha12", &stream<crand::chacha12>, 32},
+    engine_entry{"chacha20", &stream<crand::chacha20>, 32},
+    engine_entry{"pcg32", &stream<crand::pcg32>, 32},
+    engine_entry{"pcg64", &stream<crand::pcg64>, 64},
+    engine_entry{"romu_duo", &stream<crand::romu_duo>, 64},
+    engine_entry{"romu_trio", &stream<crand::romu_trio>, 64},
+    engine_entry{"splitmix64", &stream<crand::splitmix64>, 64},
+    engine_entry{"wyrand", &stream<crand::wyrand>, 64},
+    engine_entry{"xorshift32", &stream<crand::xorshift32>, 32},
+    engine_entry{"xorshift64", &stream<crand::xorshift64>, 64},
+    engine_entry{"xoshiro256_starstar", &stream<crand::xoshiro256_starstar>, 64},
+};
+
+auto usage(char const* program) -> int
+{
+    std::fprintf(stderr, "Usage: %s <engine> [seed] [bytes]\n\nEngines (native word size):\n", program);
+    for (auto const& e : engines)
+        std::fprintf(stderr, "  %-20.*s %zu bit\n", static_cast<int>(e.name.size()), e.name.data(), e.result_bits);
+    return 2;
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    if (argc < 2 || argc > 4)
+        return usage(argv[0]);
+
+    auto const* const entry = std::ranges::find(engines, std::string_view{argv[1]}, &engine_entry::name);
+    if (entry == engines.end())
+        return usage(argv[0]);
+
+    try
+    {
+        std::uint64_t const seed  = argc > 2 ? std::stoull(argv[2], nullptr, 0) : 1;
+        std::uint64_t const bytes = argc > 3 ? std::stoull(argv[3], nullptr, 0)
+                                             : std::numeric_limits<std::uint64_t>::max();
+        return entry->stream(seed, bytes);
+    }
+    catch (std::exception const&)
+    {
+        return usage(argv[0]);
+    }
+}
@@ -0,0 +1,241 @@
+//
+// MIT License
+//
+// Copyright (c) 2022 Jan Möller
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Writes engine output to a memory-mappable stream file, or reads values back from one:
+//
+//     constexpr_random-stream-file write xoshiro256_starstar stream.bin 1000000000 42
+//     constexpr_random-stream-file read stream.bin 123456789 10
+//
+// Reading past the end of the file resumes generation from the last checkpoint.
+//
+// Usage: constexpr_random-stream-file write <engine> <file> <count> [seed] [checkpoint interval]
+//        constexpr_random-stream-file read <file> <position> [count]
+
+#include <crand/engines/chacha_engine.hpp>
+#include <crand/engines/pcg_engine.hpp>
+#include <crand/engines/romu_engine.hpp>
+#include <crand/engines/splitmix64_engine.hpp>
+#include <crand/engines/stream_file.hpp>
+#include <crand/engines/wyrand_engine.hpp>
+#include <crand/engines/xorshift_engine.hpp>
+#include <crand/engines/xoshiro256_starstar_engine.hpp>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CONSTEXPR_RANDOM_HAS_MMAP 1
+#endif
+
+namespace
+{
+constexpr std::uint64_t default_checkpoint_interval = std::uint64_t{1} << 20u;
+
+// The contents of a file, memory-mapped where supported.
+class file_contents
+{
+  public:
+    explicit file_contents(char const* path)
+    {
+#ifdef CONSTEXPR_RANDOM_HAS_MMAP
+        int const fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return;
+        struct stat st = {};
+        if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+            void* const p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            if (p != MAP_FAILED)
+                m_bytes = {static_cast<std::byte const*>(p), static_cast<std::size_t>(st.st_size)};
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary);
+        std::vector<char> const data{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+        m_buffer.resize(data.size());
+        std::ranges::transform(data, m_buffer.begin(), [](char c) { return static_cast<std::byte>(c); });
+        m_bytes = m_buffer;
+#endif
+    }
+    file_contents(file_contents const&)                    = delete;
+    auto operator=(file_contents const&) -> file_contents& = delete;
+    ~file_contents()
+    {
+#ifdef CONSTEXPR_RANDOM_HAS_MMAP
+        if (!m_bytes.empty())
+            ::munmap(const_cast<std::byte*>(m_bytes.data()), m_bytes.size());
+#endif
+    }
+
+    [[nodiscard]] auto bytes() const noexcept -> std::span<std::byte const> { return m_bytes; }
+
+  private:
+    std::span<std::byte const> m_bytes;
+#ifndef CONSTEXPR_RANDOM_HAS_MMAP
+    std::vector<std::byte> m_buffer;
+#endif
+};
+
+template<typename G>
+auto write(char const* path, std::string_view name, std::uint64_t seed, std::uint64_t count, std::uint64_t interval)
+    -> int
+{
+    std::FILE* const file = std::fopen(path, "wb");
+    if (file == nullptr)
+        return 1;
+
+    bool ok = true;
+    crand::write_stream_file(
+        [&](std::span<std::byte const> chunk) {
+            ok = ok && std::fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+        },
+        G(seed),
+        name,
+        seed,
+        count,
+        interval);
+    ok = std::fclose(file) == 0 && ok;
+    return ok ? 0 : 1;
+}
+
+template<typename G>
+auto read(std::span<std::byte const> file, std::uint64_t position, std::uint64_t count) -> int
+{
+    auto const view = crand::stream_file_view<G>::open(file);
+    if (!view)
+        return 1;
+
+    // Values past the end of the file are generated from the last checkpoint
+    G g = view->engine_at(std::max(position, view->size()));
+    // Count the values separately, since `position + count` may wrap
+    for (std::uint64_t n = 0; n < count; ++n)
+    {
+        auto const i = position + n;
+        std::printf("%" PRIu64 "\n", static_cast<std::uint64_t>(i >= position && i < view->size() ? (*view)[i] : g()));
+    }
+    return 0;
+}
+
+struct engine_entry
+{
+    std::string_view name;
+    int (*write)(char const*, std::string_view, std::uint64_t, std::uint64_t, std::uint64_t);
+    int (*read)(std::span<std::byte const>, std::uint64_t, std::uint64_t);
+};
+
+template<typename G>
+constexpr auto entry(std::string_view name) -> engine_entry
+{
+    return {name, &write<G>, &read<G>};
+}
+
+constexpr std::array engines{
+    entry<crand::chacha8>("chacha8"),
+    entry<crand::chacha12>("chacha12"),
+    entry<crand::chacha20>("chacha20"),
+    entry<crand::pcg32>("pcg32"),
+    entry<crand::pcg64>("pcg64"),
+    entry<crand::romu_duo>("romu_duo"),
+    entry<crand::romu_trio>("romu_trio"),
+    entry<crand::splitmix64>("splitmix64"),
+    entry<crand::wyrand>("wyrand"),
+    entry<crand::xorshift32>("xorshift32"),
+    entry<crand::xorshift64>("xorshift64"),
+    entry<crand::xoshiro256_starstar>("xoshiro256_starstar"),
+};
+
+auto usage(char const* program) -> int
+{
+    std::fprintf(stderr,
+                 "Usage: %s write <engine> <file> <count> [seed] [checkpoint interval]\n"
+                 "       %s read <file> <position> [count]\n\nEngines:\n",
+                 program,
+                 program);
+    for (auto const& e : engines)
+        std::fprintf(stderr, "  %.*s\n", static_cast<int>(e.name.size()), e.name.data());
+    return 2;
+}
+
+auto find_engine(std::string_view name) -> engine_entry const*
+{
+    auto const* const it = std::ranges::find(engines, name, &engine_entry::name);
+    return it == engines.end() ? nullptr : it;
+}
+} // namespace
+
+auto main(int argc, char** argv) -> int
+{
+    try
+    {
+        std::string_view const command = argc > 1 ? argv[1] : "";
+        if (command == "write" && argc >= 5 && argc <= 7)
+        {
+            auto const* const engine = find_engine(argv[2]);
+            if (engine == nullptr)
+                return usage(argv[0]);
+            std::uint64_t const count    = std::stoull(argv[4], nullptr, 0);
+            std::uint64_t const seed     = argc > 5 ? std::stoull(argv[5], nullptr, 0) : 1;
+            std::uint64_t const interval = argc > 6 ? std::stoull(argv[6], nullptr, 0) : default_checkpoint_interval;
+            if (interval == 0)
+                return usage(argv[0]);
+            return engine->write(argv[3], engine->name, seed, count, interval);
+        }
+        if (command == "read" && argc >= 4 && argc <= 5)
+        {
+            file_contents const file{argv[2]};
+            auto const          header = crand::stream_file_header::decode(file.bytes());
+            if (!header)
+            {
+                std::fprintf(stderr, "%s is not a stream file\n", argv[2]);
+                return 1;
+            }
+            auto const* const engine = find_engine(header->engine_id());
+            if (engine == nullptr)
+                return 1;
+            std::uint64_t const position = std::stoull(argv[3], nullptr, 0);
+            std::uint64_t const count    = argc > 4 ? std::stoull(argv[4], nullptr, 0) : 1;
+            return engine->read(file.bytes(), position, count);
+        }
+        return usage(argv[0]);
+    }
+    catch (std::exception const&)
+    {
+        return usage(argv[0]);
+    }
+}